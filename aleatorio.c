@@ -0,0 +1,54 @@
+#include <stdlib.h>
+#include "aleatorio.h"
+
+struct stAleatorio
+{
+    unsigned long long estado;
+};
+
+tAleatorio *initAleatorio(unsigned long long semente)
+{
+    tAleatorio *aleatorio = (tAleatorio *)malloc(sizeof(tAleatorio));
+
+    aleatorio->estado = semente;
+
+    return aleatorio;
+}
+
+void freeAleatorio(tAleatorio *aleatorio)
+{
+    free(aleatorio);
+}
+
+// Finalizador do SplitMix64
+static unsigned long long mistura(unsigned long long z)
+{
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+// SplitMix64: embaralha bem até sementes consecutivas (0, 1, 2...)
+unsigned long long proximoAleatorio(tAleatorio *aleatorio)
+{
+    return mistura(aleatorio->estado += 0x9E3779B97F4A7C15ULL);
+}
+
+unsigned long long sementeDerivada(unsigned long long semente, unsigned long long indice)
+{
+    // Primeira saída de um SplitMix com estado semente ^ (indice * ímpar). O ímpar não é o
+    // incremento do gerador: com ele, o gerador i seria o 0 adiantado i passos
+    return mistura((semente ^ (indice * 0xD1B54A32D192ED03ULL)) + 0x9E3779B97F4A7C15ULL);
+}
+
+int aleatorioIntervalo(tAleatorio *aleatorio, int limite)
+{
+    return (int)(proximoAleatorio(aleatorio) % (unsigned long long)limite);
+}
+
+double aleatorioReal(tAleatorio *aleatorio)
+{
+    // Usa os 53 bits mais altos, que cabem exatamente na mantissa de um double
+    return (proximoAleatorio(aleatorio) >> 11) * (1.0 / 9007199254740992.0);
+}
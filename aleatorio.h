@@ -0,0 +1,60 @@
+#ifndef ALEATORIO_H
+#define ALEATORIO_H
+
+typedef struct stAleatorio tAleatorio;
+
+/**
+ * @brief Cria um gerador de números pseudo-aleatórios
+ * @details Cada gerador tem seu próprio estado, então pode ser usado por uma thread sem travas.
+ * A mesma semente sempre gera a mesma sequência.
+ *
+ * @param semente Semente do gerador
+ * @return tAleatorio*
+ */
+tAleatorio *initAleatorio(unsigned long long semente);
+
+/**
+ * @brief Deriva a semente do gerador número indice (partida, ilha...) a partir da semente global
+ * @details Geradores com sementes derivadas de índices diferentes têm sequências independentes;
+ * somar múltiplos do incremento do SplitMix à semente só deslocaria a mesma sequência.
+ *
+ * @param semente Semente global
+ * @param indice Número do gerador
+ * @return unsigned long long
+ */
+unsigned long long sementeDerivada(unsigned long long semente, unsigned long long indice);
+
+/**
+ * @brief Destrói o gerador
+ *
+ * @param aleatorio Gerador a ser liberado
+ */
+void freeAleatorio(tAleatorio *aleatorio);
+
+/**
+ * @brief Sorteia o próximo número de 64 bits
+ *
+ * @param aleatorio Gerador
+ * @return unsigned long long
+ */
+unsigned long long proximoAleatorio(tAleatorio *aleatorio);
+
+/**
+ * @brief Sorteia um inteiro no intervalo [0, limite)
+ *
+ * @param aleatorio Gerador
+ * @param limite Limite superior (exclusivo)
+ * @pre limite > 0
+ * @return int
+ */
+int aleatorioIntervalo(tAleatorio *aleatorio, int limite);
+
+/**
+ * @brief Sorteia um real no intervalo [0, 1)
+ *
+ * @param aleatorio Gerador
+ * @return double
+ */
+double aleatorioReal(tAleatorio *aleatorio);
+
+#endif
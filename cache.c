@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cache.h"
+
+#define VERSAO_CACHE 2
+#define ORDEM_CACHE 0x01020304u // Gravado na ordem de bytes da máquina: outra ordem lê outro valor
+
+// Cabeçalho do arquivo, na ordem de bytes da máquina que gravou (o mmap lê os inteiros direto).
+// Os campos já caem alinhados, sem preenchimento, e as seções começam em offsets múltiplos de 8
+typedef struct
+{
+    char magica[8]; // "TSPCACHE"
+    uint32_t ordem; // ORDEM_CACHE
+    uint32_t versao;
+    uint32_t tam;    // Quantidade de vértices
+    uint32_t qtdMST; // Arestas da MST: pares int32 (v1, v2), na ordem do Kruskal
+    uint64_t hash;
+    uint32_t k;         // Vizinhos por vértice: tam * k int32
+    uint32_t reservado; // Sempre 0
+    uint64_t offsetMST;
+    uint64_t offsetVizinhos;
+} tCabecalhoCache;
+
+struct stCache
+{
+    void *mapa;
+    size_t tamMapa;
+    const tCabecalhoCache *cabecalho;
+};
+
+static const char MAGICA_CACHE[8] = {'T', 'S', 'P', 'C', 'A', 'C', 'H', 'E'};
+
+static uint64_t fnv1a(uint64_t hash, const void *dados, size_t tam)
+{
+    const unsigned char *bytes = (const unsigned char *)dados;
+
+    for (size_t i = 0; i < tam; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+unsigned long long hashInstancia(tGrafo *grafo, const char *metrica)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    int32_t n = getSizeVertices(grafo);
+
+    hash = fnv1a(hash, metrica, strlen(metrica) + 1);
+    hash = fnv1a(hash, &n, sizeof(n));
+
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        float coord[2] = {getX(v), getY(v)};
+        hash = fnv1a(hash, coord, sizeof(coord));
+    }
+
+    return hash;
+}
+
+static void caminhoCache(char *caminho, size_t tam, const char *diretorio, unsigned long long hash)
+{
+    snprintf(caminho, tam, "%s/%016llx.cache", diretorio, hash);
+}
+
+static uint64_t alinha8(uint64_t offset)
+{
+    return (offset + 7) & ~(uint64_t)7;
+}
+
+// A seção [offset, offset + qtd * tamItem) cabe no arquivo, depois do cabeçalho e alinhada?
+// Compara por divisão para que contagens absurdas não estourem a multiplicação
+static int secaoCabe(uint64_t offset, uint64_t qtd, uint64_t tamItem, uint64_t tamArquivo)
+{
+    if (offset < sizeof(tCabecalhoCache) || offset % 8 || offset > tamArquivo)
+        return 0;
+
+    return qtd <= (tamArquivo - offset) / tamItem;
+}
+
+// Confere as seções contra o tamanho do arquivo e os ids contra tam: um arquivo corrompido
+// (ou gravado por outro programa) não pode levar a leituras fora do mapa nem fora do grafo
+static int cacheValido(const void *mapa, uint64_t tamArquivo, const tCabecalhoCache *cab)
+{
+    uint32_t tam = cab->tam;
+
+    if (cab->qtdMST != (tam > 1 ? tam - 1 : 0) ||
+        !secaoCabe(cab->offsetMST, cab->qtdMST, 2 * sizeof(int32_t), tamArquivo) ||
+        !secaoCabe(cab->offsetVizinhos, (uint64_t)tam * cab->k, sizeof(int32_t), tamArquivo))
+        return 0;
+
+    const int32_t *pares = (const int32_t *)((const char *)mapa + cab->offsetMST);
+    for (uint64_t i = 0; i < 2 * (uint64_t)cab->qtdMST; i++)
+        if (pares[i] < 0 || (uint32_t)pares[i] >= tam)
+            return 0;
+
+    const int32_t *lista = (const int32_t *)((const char *)mapa + cab->offsetVizinhos);
+    for (uint64_t i = 0; i < (uint64_t)tam * cab->k; i++)
+        if (lista[i] < 0 || (uint32_t)lista[i] >= tam)
+            return 0;
+
+    return 1;
+}
+
+tCache *abreCache(const char *diretorio, unsigned long long hash, int tam)
+{
+    char caminho[256];
+    caminhoCache(caminho, sizeof(caminho), diretorio, hash);
+
+    int fd = open(caminho, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat info;
+    if (fstat(fd, &info) < 0 || (size_t)info.st_size < sizeof(tCabecalhoCache))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    void *mapa = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED)
+        return NULL;
+
+    const tCabecalhoCache *cab = (const tCabecalhoCache *)mapa;
+
+    if (memcmp(cab->magica, MAGICA_CACHE, 8) || cab->ordem != ORDEM_CACHE || cab->versao != VERSAO_CACHE ||
+        cab->hash != hash || cab->tam != (uint32_t)tam || !cacheValido(mapa, info.st_size, cab))
+    {
+        munmap(mapa, info.st_size);
+        return NULL;
+    }
+
+    tCache *cache = (tCache *)malloc(sizeof(tCache));
+    cache->mapa = mapa;
+    cache->tamMapa = info.st_size;
+    cache->cabecalho = cab;
+
+    return cache;
+}
+
+void fechaCache(tCache *cache)
+{
+    munmap(cache->mapa, cache->tamMapa);
+    free(cache);
+}
+
+tAresta **getMSTCache(tCache *cache, tGrafo *grafo)
+{
+    const int32_t *pares = (const int32_t *)((const char *)cache->mapa + cache->cabecalho->offsetMST);
+
+    return initMST(grafo, pares, cache->cabecalho->qtdMST);
+}
+
+int getQtdVizinhosCache(tCache *cache)
+{
+    return cache->cabecalho->k;
+}
+
+tVizinhos *getVizinhosCache(tCache *cache)
+{
+    int32_t *lista = (int32_t *)((char *)cache->mapa + cache->cabecalho->offsetVizinhos);
+
+    return initVizinhosDeVetor(lista, cache->cabecalho->tam, cache->cabecalho->k);
+}
+
+// Completa com zeros até o offset (as seções são alinhadas)
+static void completaAte(FILE *arq, uint64_t offset)
+{
+    while ((uint64_t)ftell(arq) < offset)
+        fputc(0, arq);
+}
+
+int salvaCache(const char *diretorio, unsigned long long hash, tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos)
+{
+    int n = getSizeVertices(grafo);
+    char caminho[256], temporario[300];
+
+    mkdir(diretorio, 0755);
+    caminhoCache(caminho, sizeof(caminho), diretorio, hash);
+    snprintf(temporario, sizeof(temporario), "%s.%d.tmp", caminho, (int)getpid());
+
+    tCabecalhoCache cab;
+    memset(&cab, 0, sizeof(cab));
+    memcpy(cab.magica, MAGICA_CACHE, 8);
+    cab.ordem = ORDEM_CACHE;
+    cab.versao = VERSAO_CACHE;
+    cab.tam = n;
+    cab.hash = hash;
+    cab.qtdMST = n > 1 ? n - 1 : 0;
+    cab.k = vizinhos ? getQtdVizinhos(vizinhos) : 0;
+    cab.offsetMST = alinha8(sizeof(cab));
+    cab.offsetVizinhos = alinha8(cab.offsetMST + (uint64_t)cab.qtdMST * 2 * sizeof(int32_t));
+
+    FILE *arq = fopen(temporario, "wb");
+    if (!arq)
+        return 0;
+
+    fwrite(&cab, sizeof(cab), 1, arq);
+
+    completaAte(arq, cab.offsetMST);
+    for (uint32_t i = 0; i < cab.qtdMST; i++)
+    {
+        int32_t par[2] = {getV1(MST[i]), getV2(MST[i])};
+        fwrite(par, sizeof(par), 1, arq);
+    }
+
+    completaAte(arq, cab.offsetVizinhos);
+    for (int i = 0; i < n && cab.k > 0; i++)
+        fwrite(getVizinhos(vizinhos, i), sizeof(int32_t), cab.k, arq);
+
+    int ok = !ferror(arq);
+    ok = !fclose(arq) && ok;
+
+    if (!ok || rename(temporario, caminho))
+    {
+        remove(temporario);
+        return 0;
+    }
+
+    return 1;
+}
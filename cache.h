@@ -0,0 +1,80 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "grafo.h"
+#include "vizinhos.h"
+
+typedef struct stCache tCache;
+
+/**
+ * @brief Calcula o hash (FNV-1a de 64 bits) que identifica uma instância
+ * @details Depende da métrica, da quantidade de vértices e dos bits exatos das coordenadas.
+ * O nome da instância não entra: o mesmo conteúdo com outro nome acha o mesmo cache.
+ *
+ * @param grafo Grafo com o vetor de vértices preenchido
+ * @param metrica Tipo de distância (ex.: "EUC_2D")
+ * @return unsigned long long
+ */
+unsigned long long hashInstancia(tGrafo *grafo, const char *metrica);
+
+/**
+ * @brief Abre (mmap) o arquivo de cache da instância, se existir e for válido
+ * @details Arquivos de outra versão do formato, de outro tamanho, truncados ou gravados numa
+ * máquina com outra ordem de bytes são ignorados, assim como os que têm seções fora do arquivo,
+ * uma MST sem tam - 1 arestas ou algum id de vértice fora de [0, tam).
+ *
+ * @param diretorio Diretório dos arquivos de cache
+ * @param hash Hash da instância
+ * @param tam Quantidade de vértices esperada
+ * @return tCache*, ou NULL se não houver cache utilizável
+ */
+tCache *abreCache(const char *diretorio, unsigned long long hash, int tam);
+
+/**
+ * @brief Fecha o cache (desfaz o mmap)
+ *
+ * @param cache Cache a ser fechado
+ */
+void fechaCache(tCache *cache);
+
+/**
+ * @brief Monta a MST guardada no cache, na mesma ordem em que o Kruskal a gerou
+ *
+ * @param cache Cache aberto
+ * @param grafo Grafo com o vetor de vértices
+ * @return tAresta** (liberar com freeMST)
+ */
+tAresta **getMSTCache(tCache *cache, tGrafo *grafo);
+
+/**
+ * @brief Pega a quantidade de vizinhos por vértice guardada no cache
+ *
+ * @param cache Cache aberto
+ * @return int (0 se o cache não tem listas de candidatos)
+ */
+int getQtdVizinhosCache(tCache *cache);
+
+/**
+ * @brief Monta as listas de candidatos guardadas no cache
+ *
+ * @param cache Cache aberto
+ * @pre getQtdVizinhosCache(cache) > 0
+ * @return tVizinhos*
+ */
+tVizinhos *getVizinhosCache(tCache *cache);
+
+/**
+ * @brief Grava o cache da instância
+ * @details Escreve em um arquivo temporário e renomeia, para que uma leitura concorrente
+ * nunca veja um arquivo pela metade. Cria o diretório se precisar.
+ *
+ * @param diretorio Diretório dos arquivos de cache
+ * @param hash Hash da instância
+ * @param grafo Grafo com o vetor de vértices
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param vizinhos Listas de candidatos (pode ser NULL)
+ * @return 1 se gravou, 0 se não
+ */
+int salvaCache(const char *diretorio, unsigned long long hash, tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos);
+
+#endif
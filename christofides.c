@@ -0,0 +1,774 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "christofides.h"
+#include "tempo.h"
+#include "vizinhos.h"
+#include "tour.h"
+
+#define PESO_MAXIMO_BLOSSOM 100000000 // Pesos inteiros do blossom: 4 * peso ainda cabe em int
+#define INFINITO_BLOSSOM 1000000000
+#define CANDIDATOS_GULOSO 8 // Vizinhos por vértice ímpar no emparelhamento guloso
+#define PASSADAS_TROCA 50   // Máximo de passadas de trocas 2-opt entre pares
+
+// ---------------------- Emparelhamento exato (blossom) ---------------------- //
+
+// Emparelhamento de peso máximo em grafo geral, O(n³), com as variáveis duais inteiras.
+// Vértices são 1..n e blossoms n+1..2n; o índice 0 é "nenhum".
+typedef struct
+{
+    int u, v, w;
+} tArestaBlossom;
+
+typedef struct
+{
+    int n, nx, dim;      // dim == 2n + 1; nx é o maior índice de blossom em uso
+    tArestaBlossom *g;   // g[u * dim + v]: aresta de menor folga entre u e v (w == 0 se não há)
+    int *dual;           // Variável dual de vértices e blossoms
+    int *par;            // Vértice emparelhado com cada vértice ou blossom
+    int *folga;          // Vértice da aresta de menor folga chegando a cada vértice de topo
+    int *topo;           // Blossom de nível mais alto que contém cada vértice
+    int *pai;            // Vértice pelo qual cada vértice de tipo 1 foi alcançado
+    int *tipo;           // 0: par (raiz a distância par), 1: ímpar, -1: fora da floresta
+    int *vis;            // Marcas da busca do ancestral comum
+    int *flor, *tamFlor; // Filhos do blossom b, em ciclo: flor[b * (n + 1) + i]
+    int *florDe;         // florDe[b * (n + 1) + x]: filho de b que contém o vértice x
+    int *aux;            // Espaço da rotação dos filhos
+    int *fila, inicioFila, fimFila, capFila;
+    int marca;
+} tBlossom;
+
+#define G(b, x, y) ((b)->g[(size_t)(x) * (b)->dim + (y)])
+#define FLOR(b, x) ((b)->flor + (size_t)(x) * ((b)->n + 1))
+#define FLOR_DE(b, x) ((b)->florDe + (size_t)(x) * ((b)->n + 1))
+#define FOLGA(b, e) ((b)->dual[(e).u] + (b)->dual[(e).v] - (e).w * 2)
+
+static void inverteTrecho(int *v, int tam)
+{
+    for (int i = 0, j = tam - 1; i < j; i++, j--)
+    {
+        int aux = v[i];
+        v[i] = v[j];
+        v[j] = aux;
+    }
+}
+
+static void atualizaFolga(tBlossom *b, int u, int x)
+{
+    if (!b->folga[x] || FOLGA(b, G(b, u, x)) < FOLGA(b, G(b, b->folga[x], x)))
+        b->folga[x] = u;
+}
+
+static void defineFolga(tBlossom *b, int x)
+{
+    b->folga[x] = 0;
+    for (int u = 1; u <= b->n; u++)
+    {
+        if (G(b, u, x).w > 0 && b->topo[u] != x && b->tipo[b->topo[u]] == 0)
+            atualizaFolga(b, u, x);
+    }
+}
+
+// Põe na fila o vértice ou, se for blossom, todos os vértices dele
+static void enfileira(tBlossom *b, int x)
+{
+    if (x <= b->n)
+    {
+        if (b->fimFila == b->capFila)
+        {
+            b->capFila *= 2;
+            b->fila = (int *)realloc(b->fila, b->capFila * sizeof(int));
+        }
+        b->fila[b->fimFila++] = x;
+        return;
+    }
+
+    int *f = FLOR(b, x);
+    for (int i = 0; i < b->tamFlor[x]; i++)
+        enfileira(b, f[i]);
+}
+
+static void defineTopo(tBlossom *b, int x, int topo)
+{
+    b->topo[x] = topo;
+    if (x <= b->n)
+        return;
+
+    int *f = FLOR(b, x);
+    for (int i = 0; i < b->tamFlor[x]; i++)
+        defineTopo(b, f[i], topo);
+}
+
+// Posição par de xr no ciclo de filhos de x (inverte o ciclo se a posição for ímpar)
+static int posicaoPar(tBlossom *b, int x, int xr)
+{
+    int *f = FLOR(b, x);
+    int tam = b->tamFlor[x];
+    int pos = 0;
+
+    while (f[pos] != xr)
+        pos++;
+
+    if (pos % 2 == 1)
+    {
+        inverteTrecho(f + 1, tam - 1);
+        return tam - pos;
+    }
+    return pos;
+}
+
+static void casa(tBlossom *b, int u, int v)
+{
+    tArestaBlossom e = G(b, u, v);
+    b->par[u] = e.v;
+
+    if (u <= b->n)
+        return;
+
+    int *f = FLOR(b, u);
+    int tam = b->tamFlor[u];
+    int xr = FLOR_DE(b, u)[e.u];
+    int pos = posicaoPar(b, u, xr);
+
+    for (int i = 0; i < pos; i++)
+        casa(b, f[i], f[i ^ 1]);
+    casa(b, xr, v);
+
+    // O filho emparelhado para fora passa a ser a base do blossom
+    memcpy(b->aux, f + pos, (tam - pos) * sizeof(int));
+    memcpy(b->aux + tam - pos, f, pos * sizeof(int));
+    memcpy(f, b->aux, tam * sizeof(int));
+}
+
+// Inverte o caminho aumentante que termina na aresta u-v
+static void aumenta(tBlossom *b, int u, int v)
+{
+    for (;;)
+    {
+        int xnv = b->topo[b->par[u]];
+        casa(b, u, v);
+        if (!xnv)
+            return;
+        casa(b, xnv, b->topo[b->pai[xnv]]);
+        u = b->topo[b->pai[xnv]];
+        v = xnv;
+    }
+}
+
+// Ancestral comum de u e v na floresta alternante (0 se estão em árvores diferentes)
+static int ancestral(tBlossom *b, int u, int v)
+{
+    b->marca++;
+
+    while (u || v)
+    {
+        if (u)
+        {
+            if (b->vis[u] == b->marca)
+                return u;
+            b->vis[u] = b->marca;
+            u = b->topo[b->par[u]];
+            if (u)
+                u = b->topo[b->pai[u]];
+        }
+
+        int aux = u;
+        u = v;
+        v = aux;
+    }
+
+    return 0;
+}
+
+static void criaBlossom(tBlossom *b, int u, int lca, int v)
+{
+    int n = b->n;
+    int nb = n + 1;
+    int x, y;
+
+    while (nb <= b->nx && b->topo[nb])
+        nb++;
+    if (nb > b->nx)
+        b->nx++;
+
+    b->dual[nb] = 0;
+    b->tipo[nb] = 0;
+    b->par[nb] = b->par[lca];
+
+    int *f = FLOR(b, nb);
+    int tam = 0;
+    f[tam++] = lca;
+    for (x = u; x != lca; x = b->topo[b->pai[y]])
+    {
+        f[tam++] = x;
+        f[tam++] = y = b->topo[b->par[x]];
+        enfileira(b, y);
+    }
+    inverteTrecho(f + 1, tam - 1);
+    for (x = v; x != lca; x = b->topo[b->pai[y]])
+    {
+        f[tam++] = x;
+        f[tam++] = y = b->topo[b->par[x]];
+        enfileira(b, y);
+    }
+    b->tamFlor[nb] = tam;
+    defineTopo(b, nb, nb);
+
+    for (x = 1; x <= b->nx; x++)
+        G(b, nb, x).w = G(b, x, nb).w = 0;
+    for (x = 1; x <= n; x++)
+        FLOR_DE(b, nb)[x] = 0;
+
+    for (int i = 0; i < tam; i++)
+    {
+        int xs = f[i];
+        for (x = 1; x <= b->nx; x++)
+        {
+            if (G(b, nb, x).w == 0 || FOLGA(b, G(b, xs, x)) < FOLGA(b, G(b, nb, x)))
+            {
+                G(b, nb, x) = G(b, xs, x);
+                G(b, x, nb) = G(b, x, xs);
+            }
+        }
+        for (x = 1; x <= n; x++)
+        {
+            if (FLOR_DE(b, xs)[x])
+                FLOR_DE(b, nb)[x] = xs;
+        }
+    }
+
+    defineFolga(b, nb);
+}
+
+static void expandeBlossom(tBlossom *b, int nb)
+{
+    int *f = FLOR(b, nb);
+    int tam = b->tamFlor[nb];
+
+    for (int i = 0; i < tam; i++)
+        defineTopo(b, f[i], f[i]);
+
+    int xr = FLOR_DE(b, nb)[G(b, nb, b->pai[nb]).u];
+    int pos = posicaoPar(b, nb, xr);
+
+    for (int i = 0; i < pos; i += 2)
+    {
+        int xs = f[i], xns = f[i + 1];
+        b->pai[xs] = G(b, xns, xs).u;
+        b->tipo[xs] = 1;
+        b->tipo[xns] = 0;
+        b->folga[xs] = 0;
+        defineFolga(b, xns);
+        enfileira(b, xns);
+    }
+    b->tipo[xr] = 1;
+    b->pai[xr] = b->pai[nb];
+    for (int i = pos + 1; i < tam; i++)
+    {
+        b->tipo[f[i]] = -1;
+        defineFolga(b, f[i]);
+    }
+
+    b->topo[nb] = 0;
+}
+
+// Retorna 1 se a aresta (de folga zero) completou um caminho aumentante
+static int arestaApertada(tBlossom *b, tArestaBlossom e)
+{
+    int u = b->topo[e.u], v = b->topo[e.v];
+
+    if (b->tipo[v] == -1)
+    {
+        b->pai[v] = e.u;
+        b->tipo[v] = 1;
+        int nu = b->topo[b->par[v]];
+        b->folga[v] = b->folga[nu] = 0;
+        b->tipo[nu] = 0;
+        enfileira(b, nu);
+    }
+    else if (b->tipo[v] == 0)
+    {
+        int lca = ancestral(b, u, v);
+        if (!lca)
+        {
+            aumenta(b, u, v);
+            aumenta(b, v, u);
+            return 1;
+        }
+        criaBlossom(b, u, lca, v);
+    }
+
+    return 0;
+}
+
+// Uma fase: procura um caminho aumentante, ajustando as duais. Retorna 0 se não há mais
+static int faseBlossom(tBlossom *b)
+{
+    int n = b->n;
+
+    for (int x = 1; x <= b->nx; x++)
+    {
+        b->tipo[x] = -1;
+        b->folga[x] = 0;
+    }
+
+    b->inicioFila = b->fimFila = 0;
+    for (int x = 1; x <= b->nx; x++)
+    {
+        if (b->topo[x] == x && !b->par[x])
+        {
+            b->pai[x] = 0;
+            b->tipo[x] = 0;
+            enfileira(b, x);
+        }
+    }
+    if (b->fimFila == 0)
+        return 0;
+
+    for (;;)
+    {
+        while (b->inicioFila < b->fimFila)
+        {
+            int u = b->fila[b->inicioFila++];
+            if (b->tipo[b->topo[u]] == 1)
+                continue;
+
+            for (int v = 1; v <= n; v++)
+            {
+                if (G(b, u, v).w > 0 && b->topo[u] != b->topo[v])
+                {
+                    if (FOLGA(b, G(b, u, v)) == 0)
+                    {
+                        if (arestaApertada(b, G(b, u, v)))
+                            return 1;
+                    }
+                    else
+                        atualizaFolga(b, u, b->topo[v]);
+                }
+            }
+        }
+
+        int d = INFINITO_BLOSSOM;
+        for (int nb = n + 1; nb <= b->nx; nb++)
+        {
+            if (b->topo[nb] == nb && b->tipo[nb] == 1 && b->dual[nb] / 2 < d)
+                d = b->dual[nb] / 2;
+        }
+        for (int x = 1; x <= b->nx; x++)
+        {
+            if (b->topo[x] == x && b->folga[x])
+            {
+                int f = FOLGA(b, G(b, b->folga[x], x));
+                if (b->tipo[x] == -1 && f < d)
+                    d = f;
+                else if (b->tipo[x] == 0 && f / 2 < d)
+                    d = f / 2;
+            }
+        }
+
+        for (int u = 1; u <= n; u++)
+        {
+            if (b->tipo[b->topo[u]] == 0)
+            {
+                if (b->dual[u] <= d)
+                    return 0;
+                b->dual[u] -= d;
+            }
+            else if (b->tipo[b->topo[u]] == 1)
+                b->dual[u] += d;
+        }
+        for (int nb = n + 1; nb <= b->nx; nb++)
+        {
+            if (b->topo[nb] == nb)
+            {
+                if (b->tipo[nb] == 0)
+                    b->dual[nb] += d * 2;
+                else if (b->tipo[nb] == 1)
+                    b->dual[nb] -= d * 2;
+            }
+        }
+
+        b->inicioFila = b->fimFila = 0;
+        for (int x = 1; x <= b->nx; x++)
+        {
+            if (b->topo[x] == x && b->folga[x] && b->topo[b->folga[x]] != x &&
+                FOLGA(b, G(b, b->folga[x], x)) == 0)
+            {
+                if (arestaApertada(b, G(b, b->folga[x], x)))
+                    return 1;
+            }
+        }
+        for (int nb = n + 1; nb <= b->nx; nb++)
+        {
+            if (b->topo[nb] == nb && b->tipo[nb] == 1 && b->dual[nb] == 0)
+                expandeBlossom(b, nb);
+        }
+    }
+}
+
+// Emparelhamento perfeito de peso mínimo: peso máximo com pesos PESO_MAXIMO_BLOSSOM + 1 - d.
+// No grafo completo com pesos positivos o emparelhamento de peso máximo é perfeito.
+static void emparelhamentoExato(tGrafo *grafo, int *impares, int m, int *par)
+{
+    tBlossom b;
+    b.n = m;
+    b.nx = m;
+    b.dim = 2 * m + 1;
+    b.g = (tArestaBlossom *)calloc((size_t)b.dim * b.dim, sizeof(tArestaBlossom));
+    b.dual = (int *)calloc(b.dim, sizeof(int));
+    b.par = (int *)calloc(b.dim, sizeof(int));
+    b.folga = (int *)calloc(b.dim, sizeof(int));
+    b.topo = (int *)calloc(b.dim, sizeof(int));
+    b.pai = (int *)calloc(b.dim, sizeof(int));
+    b.tipo = (int *)calloc(b.dim, sizeof(int));
+    b.vis = (int *)calloc(b.dim, sizeof(int));
+    b.flor = (int *)malloc((size_t)b.dim * (m + 1) * sizeof(int));
+    b.tamFlor = (int *)calloc(b.dim, sizeof(int));
+    b.florDe = (int *)calloc((size_t)b.dim * (m + 1), sizeof(int));
+    b.aux = (int *)malloc((m + 1) * sizeof(int));
+    b.capFila = 2 * m;
+    b.fila = (int *)malloc(b.capFila * sizeof(int));
+    b.marca = 0;
+
+    // Escala das distâncias pela diagonal da caixa dos vértices ímpares
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    for (int i = 0; i < m; i++)
+    {
+        tVertice *v = getVertice(grafo, impares[i]);
+        if (i == 0 || getX(v) < minX)
+            minX = getX(v);
+        if (i == 0 || getX(v) > maxX)
+            maxX = getX(v);
+        if (i == 0 || getY(v) < minY)
+            minY = getY(v);
+        if (i == 0 || getY(v) > maxY)
+            maxY = getY(v);
+    }
+    double diagonal = sqrt((double)(maxX - minX) * (maxX - minX) + (double)(maxY - minY) * (maxY - minY));
+    double escala = diagonal > 0 ? PESO_MAXIMO_BLOSSOM / diagonal : 1;
+
+    for (int u = 1; u <= m; u++)
+    {
+        for (int v = 1; v <= m; v++)
+        {
+            G(&b, u, v).u = u;
+            G(&b, u, v).v = v;
+            if (u < v)
+            {
+                long long peso = llround(distVertices(grafo, impares[u - 1], impares[v - 1]) * escala);
+                if (peso > PESO_MAXIMO_BLOSSOM)
+                    peso = PESO_MAXIMO_BLOSSOM;
+                G(&b, u, v).w = PESO_MAXIMO_BLOSSOM + 1 - (int)peso;
+            }
+            else if (u > v)
+                G(&b, u, v).w = G(&b, v, u).w;
+        }
+    }
+
+    for (int u = 0; u < b.dim; u++)
+        b.topo[u] = u;
+    for (int u = 1; u <= m; u++)
+    {
+        FLOR_DE(&b, u)[u] = u;
+        b.dual[u] = PESO_MAXIMO_BLOSSOM + 1;
+    }
+
+    while (faseBlossom(&b))
+        ;
+
+    // Com pesos positivos todos saem emparelhados; a costura abaixo é só uma proteção
+    int sobra = -1;
+    for (int u = 1; u <= m; u++)
+    {
+        par[u - 1] = b.par[u] - 1;
+        if (b.par[u] == 0)
+        {
+            if (sobra < 0)
+                sobra = u - 1;
+            else
+            {
+                par[sobra] = u - 1;
+                par[u - 1] = sobra;
+                sobra = -1;
+            }
+        }
+    }
+
+    free(b.g);
+    free(b.dual);
+    free(b.par);
+    free(b.folga);
+    free(b.topo);
+    free(b.pai);
+    free(b.tipo);
+    free(b.vis);
+    free(b.flor);
+    free(b.tamFlor);
+    free(b.florDe);
+    free(b.aux);
+    free(b.fila);
+}
+
+// ------------------------- Emparelhamento guloso ------------------------- //
+
+typedef struct
+{
+    float dist;
+    int a, b;
+} tParCandidato;
+
+static int compParCandidato(const void *p1, const void *p2)
+{
+    const tParCandidato *a = (const tParCandidato *)p1;
+    const tParCandidato *b = (const tParCandidato *)p2;
+
+    if (a->dist != b->dist)
+        return (a->dist > b->dist) - (a->dist < b->dist);
+    if (a->a != b->a)
+        return a->a - b->a;
+    return a->b - b->b;
+}
+
+static float distImpares(tGrafo *grafo, int *impares, int a, int b)
+{
+    return distVertices(grafo, impares[a], impares[b]);
+}
+
+// Pares mais próximos primeiro, entre os vizinhos da grade. Quem sobra (todos os vizinhos já
+// emparelhados) entra numa nova rodada só com os que sobraram; o par mais próximo entre eles
+// sempre é candidato, então cada rodada emparelha alguém. Depois, trocas 2-opt entre pares.
+static void emparelhamentoGuloso(tGrafo *grafo, int *impares, int m, int *par)
+{
+    int *restantes = (int *)malloc(m * sizeof(int));
+    tParCandidato *pares = (tParCandidato *)malloc((size_t)m * CANDIDATOS_GULOSO * sizeof(tParCandidato));
+    tVizinhos *todos = NULL;
+    int qtdRestantes = m;
+
+    for (int i = 0; i < m; i++)
+    {
+        par[i] = -1;
+        restantes[i] = i;
+    }
+
+    while (qtdRestantes > 0)
+    {
+        tGrafo *sub = initGrafo();
+        setSizeVertices(sub, qtdRestantes);
+        for (int i = 0; i < qtdRestantes; i++)
+            setVertice(sub, i, getVertice(grafo, impares[restantes[i]]));
+
+        tVizinhos *vizinhos = initVizinhos(sub, CANDIDATOS_GULOSO);
+        int k = getQtdVizinhos(vizinhos);
+        int qtd = 0;
+
+        for (int i = 0; i < qtdRestantes; i++)
+        {
+            int *lista = getVizinhos(vizinhos, i);
+            for (int j = 0; j < k; j++)
+            {
+                int a = restantes[i], b = restantes[lista[j]];
+                pares[qtd].dist = distImpares(grafo, impares, a, b);
+                pares[qtd].a = a < b ? a : b;
+                pares[qtd].b = a < b ? b : a;
+                qtd++;
+            }
+        }
+        qsort(pares, qtd, sizeof(tParCandidato), compParCandidato);
+
+        for (int i = 0; i < qtd; i++)
+        {
+            if (par[pares[i].a] < 0 && par[pares[i].b] < 0)
+            {
+                par[pares[i].a] = pares[i].b;
+                par[pares[i].b] = pares[i].a;
+            }
+        }
+
+        int novaQtd = 0;
+        for (int i = 0; i < qtdRestantes; i++)
+        {
+            if (par[restantes[i]] < 0)
+                restantes[novaQtd++] = restantes[i];
+        }
+        qtdRestantes = novaQtd;
+
+        // Os candidatos da primeira rodada (todos os ímpares) servem para as trocas
+        if (!todos)
+            todos = vizinhos;
+        else
+            freeVizinhos(vizinhos);
+        freeGrafo(sub);
+    }
+
+    // Troca a-b, c-d por a-c, b-d ou a-d, b-c quando fica mais curto
+    int k = getQtdVizinhos(todos);
+    int melhorou = 1;
+    for (int passada = 0; passada < PASSADAS_TROCA && melhorou; passada++)
+    {
+        melhorou = 0;
+        for (int a = 0; a < m; a++)
+        {
+            int *lista = getVizinhos(todos, a);
+            for (int j = 0; j < k; j++)
+            {
+                int c = lista[j];
+                int b = par[a], d = par[c];
+                if (c == b)
+                    continue;
+
+                float atual = distImpares(grafo, impares, a, b) + distImpares(grafo, impares, c, d);
+                float cruzado = distImpares(grafo, impares, a, c) + distImpares(grafo, impares, b, d);
+                float oposto = distImpares(grafo, impares, a, d) + distImpares(grafo, impares, b, c);
+
+                if (cruzado <= oposto && cruzado < atual - 1e-4f)
+                {
+                    par[a] = c, par[c] = a;
+                    par[b] = d, par[d] = b;
+                    melhorou = 1;
+                }
+                else if (oposto < cruzado && oposto < atual - 1e-4f)
+                {
+                    par[a] = d, par[d] = a;
+                    par[b] = c, par[c] = b;
+                    melhorou = 1;
+                }
+            }
+        }
+    }
+
+    if (todos)
+        freeVizinhos(todos);
+    free(pares);
+    free(restantes);
+}
+
+// --------------------------- Circuito de Euler --------------------------- //
+
+// Hierholzer a partir do vértice 0; cada vértice entra no tour na primeira vez que sai da pilha
+static void circuitoEuler(int tam, int *pontas, int qtdArestas, int *tour)
+{
+    int *inicio = (int *)calloc(tam + 1, sizeof(int));
+    int *adj = (int *)malloc(2 * qtdArestas * sizeof(int));
+    int *proximo = (int *)malloc(tam * sizeof(int));
+    int *pilha = (int *)malloc((qtdArestas + 1) * sizeof(int));
+    char *usada = (char *)calloc(qtdArestas, sizeof(char));
+    char *visitado = (char *)calloc(tam, sizeof(char));
+
+    for (int e = 0; e < 2 * qtdArestas; e++)
+        inicio[pontas[e] + 1]++;
+    for (int v = 0; v < tam; v++)
+        inicio[v + 1] += inicio[v];
+
+    memcpy(proximo, inicio, tam * sizeof(int));
+    for (int e = 0; e < qtdArestas; e++)
+    {
+        adj[proximo[pontas[2 * e]]++] = e;
+        adj[proximo[pontas[2 * e + 1]]++] = e;
+    }
+    memcpy(proximo, inicio, tam * sizeof(int));
+
+    int topo = 0, qtd = 0;
+    pilha[topo++] = 0;
+
+    while (topo > 0)
+    {
+        int v = pilha[topo - 1];
+
+        while (proximo[v] < inicio[v + 1] && usada[adj[proximo[v]]])
+            proximo[v]++;
+
+        if (proximo[v] == inicio[v + 1])
+        {
+            topo--;
+            if (!visitado[v])
+            {
+                visitado[v] = 1;
+                tour[qtd++] = v;
+            }
+        }
+        else
+        {
+            int e = adj[proximo[v]++];
+            usada[e] = 1;
+            pilha[topo++] = pontas[2 * e] + pontas[2 * e + 1] - v;
+        }
+    }
+
+    free(inicio);
+    free(adj);
+    free(proximo);
+    free(pilha);
+    free(usada);
+    free(visitado);
+}
+
+double christofides(tGrafo *grafo, tAresta **MST, int limiteExato, int *tour)
+{
+    int tam = getSizeVertices(grafo);
+
+    if (tam < 3)
+    {
+        for (int i = 0; i < tam; i++)
+            tour[i] = i;
+        return comprimentoTour(grafo, tour, tam);
+    }
+
+    int *grau = (int *)calloc(tam, sizeof(int));
+    for (int i = 0; i < tam - 1; i++)
+    {
+        grau[getV1(MST[i])]++;
+        grau[getV2(MST[i])]++;
+    }
+
+    int m = 0;
+    int *impares = (int *)malloc(tam * sizeof(int));
+    for (int v = 0; v < tam; v++)
+    {
+        if (grau[v] % 2 == 1)
+            impares[m++] = v;
+    }
+
+    double inicio = agora();
+    int *par = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+    int exato = m <= limiteExato;
+
+    if (exato)
+        emparelhamentoExato(grafo, impares, m, par);
+    else
+        emparelhamentoGuloso(grafo, impares, m, par);
+
+    // Multigrafo euleriano: MST + emparelhamento
+    int qtdArestas = tam - 1 + m / 2;
+    int *pontas = (int *)malloc(2 * qtdArestas * sizeof(int));
+    double peso = 0;
+    int e = 0;
+
+    for (int i = 0; i < tam - 1; i++, e++)
+    {
+        pontas[2 * e] = getV1(MST[i]);
+        pontas[2 * e + 1] = getV2(MST[i]);
+    }
+    for (int i = 0; i < m; i++)
+    {
+        if (i < par[i])
+        {
+            pontas[2 * e] = impares[i];
+            pontas[2 * e + 1] = impares[par[i]];
+            peso += distVertices(grafo, impares[i], impares[par[i]]);
+            e++;
+        }
+    }
+
+    printf("Christofides: %d vértices ímpares, emparelhamento %s de peso %.2f (%.3f s)\n", m,
+           exato ? "exato" : "guloso", peso, agora() - inicio);
+
+    circuitoEuler(tam, pontas, qtdArestas, tour);
+
+    free(pontas);
+    free(par);
+    free(impares);
+    free(grau);
+
+    return comprimentoTour(grafo, tour, tam);
+}
@@ -0,0 +1,23 @@
+#ifndef CHRISTOFIDES_H
+#define CHRISTOFIDES_H
+
+#include "grafo.h"
+
+/**
+ * @brief Gera o tour pelo algoritmo de Christofides (garantia de 1,5-aproximação)
+ * @details Os vértices de grau ímpar da MST recebem um emparelhamento perfeito: exato (blossom
+ * de Edmonds com pesos, O(m³) em tempo e O(m²) em memória) quando são no máximo limiteExato,
+ * e guloso sobre os vizinhos mais próximos (grade), refinado por trocas 2-opt entre pares,
+ * acima disso. A MST mais o emparelhamento formam um multigrafo euleriano: o circuito de
+ * Euler sai pelo algoritmo de Hierholzer e o tour é o circuito sem os vértices repetidos.
+ * Imprime uma linha com a quantidade de vértices ímpares, o método e o peso do emparelhamento.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param limiteExato Máximo de vértices ímpares para o emparelhamento exato
+ * @param tour Vetor de saída, com Qtd_vértices posições
+ * @return Comprimento do tour
+ */
+double christofides(tGrafo *grafo, tAresta **MST, int limiteExato, int *tour);
+
+#endif
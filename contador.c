@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "contador.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+struct stContador
+{
+    int fd;
+};
+
+tContador *initContador()
+{
+#ifdef __linux__
+    struct perf_event_attr atributos;
+    memset(&atributos, 0, sizeof(atributos));
+    atributos.type = PERF_TYPE_HARDWARE;
+    atributos.size = sizeof(atributos);
+    atributos.config = PERF_COUNT_HW_CACHE_MISSES;
+    atributos.disabled = 1;
+    atributos.exclude_kernel = 1;
+    atributos.exclude_hv = 1;
+    atributos.inherit = 1; // Conta também as threads criadas depois
+
+    // Este processo, em qualquer CPU
+    int fd = (int)syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0);
+    if (fd < 0)
+        return NULL;
+
+    tContador *contador = (tContador *)malloc(sizeof(tContador));
+    contador->fd = fd;
+
+    return contador;
+#else
+    return NULL;
+#endif
+}
+
+void freeContador(tContador *contador)
+{
+#ifdef __linux__
+    close(contador->fd);
+#endif
+    free(contador);
+}
+
+void iniciaContador(tContador *contador)
+{
+#ifdef __linux__
+    ioctl(contador->fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(contador->fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+long long leContador(tContador *contador)
+{
+#ifdef __linux__
+    long long valor;
+
+    ioctl(contador->fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(contador->fd, &valor, sizeof(valor)) != sizeof(valor))
+        return -1;
+
+    return valor;
+#else
+    return -1;
+#endif
+}
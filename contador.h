@@ -0,0 +1,37 @@
+#ifndef CONTADOR_H
+#define CONTADOR_H
+
+typedef struct stContador tContador;
+
+/**
+ * @brief Abre o contador de falhas de cache (último nível) do processo, via perf_event_open
+ * @details Só existe no Linux e depende do kernel expor os contadores de hardware (em muitas
+ * máquinas virtuais e contêineres eles não existem, ou perf_event_paranoid bloqueia).
+ *
+ * @return tContador*, ou NULL se o contador não estiver disponível
+ */
+tContador *initContador();
+
+/**
+ * @brief Fecha o contador
+ *
+ * @param contador Contador a ser liberado
+ */
+void freeContador(tContador *contador);
+
+/**
+ * @brief Zera e liga o contador
+ *
+ * @param contador Contador
+ */
+void iniciaContador(tContador *contador);
+
+/**
+ * @brief Desliga o contador e lê o valor
+ *
+ * @param contador Contador
+ * @return long long Falhas de cache desde iniciaContador, ou -1 se a leitura falhar
+ */
+long long leContador(tContador *contador);
+
+#endif
@@ -0,0 +1,482 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "desenho.h"
+
+#define MARGEM_DESENHO 10
+
+struct stDesenho
+{
+    int largura, altura;
+    int qtdVertices;
+
+    // Coordenadas de cada vértice já em pixels (y cresce para baixo)
+    int *px, *py;
+
+    tAresta **MST;
+    int qtdMST;
+    int *tour;
+    int tamTour;
+    int *referencia;
+    int tamReferencia;
+
+    unsigned char *pixels; // RGB, linha a linha
+};
+
+typedef struct
+{
+    unsigned char r, g, b;
+} tCor;
+
+static const tCor COR_REFERENCIA = {60, 170, 60};
+static const tCor COR_MST = {110, 220, 230};
+static const tCor COR_TOUR = {220, 30, 30};
+static const tCor COR_CIDADE = {0, 0, 0};
+
+// ------------------------- Inicialização ------------------------- //
+
+tDesenho *initDesenho(tGrafo *grafo, int largura)
+{
+    tDesenho *desenho = (tDesenho *)calloc(1, sizeof(tDesenho));
+    int n = getSizeVertices(grafo);
+
+    if (largura < 2 * MARGEM_DESENHO + 2)
+        largura = 2 * MARGEM_DESENHO + 2;
+
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        if (i == 0 || getX(v) < minX)
+            minX = getX(v);
+        if (i == 0 || getX(v) > maxX)
+            maxX = getX(v);
+        if (i == 0 || getY(v) < minY)
+            minY = getY(v);
+        if (i == 0 || getY(v) > maxY)
+            maxY = getY(v);
+    }
+
+    float spanX = maxX - minX > 0 ? maxX - minX : 1;
+    float spanY = maxY - minY > 0 ? maxY - minY : 1;
+    float util = largura - 2 * MARGEM_DESENHO - 1;
+    float escala = util / spanX;
+
+    desenho->largura = largura;
+    desenho->altura = 2 * MARGEM_DESENHO + 1 + (int)ceilf(spanY * escala);
+    desenho->qtdVertices = n;
+    desenho->px = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    desenho->py = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        desenho->px[i] = MARGEM_DESENHO + (int)lrintf((getX(v) - minX) * escala);
+        desenho->py[i] = desenho->altura - 1 - MARGEM_DESENHO - (int)lrintf((getY(v) - minY) * escala);
+    }
+
+    return desenho;
+}
+
+void freeDesenho(tDesenho *desenho)
+{
+    free(desenho->px);
+    free(desenho->py);
+    free(desenho->pixels);
+    free(desenho);
+}
+
+void setMSTDesenho(tDesenho *desenho, tAresta **MST, int qtd)
+{
+    desenho->MST = MST;
+    desenho->qtdMST = qtd;
+}
+
+void setTourDesenho(tDesenho *desenho, int *tour, int tam)
+{
+    desenho->tour = tour;
+    desenho->tamTour = tam;
+}
+
+void setReferenciaDesenho(tDesenho *desenho, int *tour, int tam)
+{
+    desenho->referencia = tour;
+    desenho->tamReferencia = tam;
+}
+
+// ---------------------------- Raster ---------------------------- //
+
+// Com poucas cidades por área as linhas ficam mais grossas, como no tsp_plot.py
+static int raioBase(tDesenho *desenho)
+{
+    double area = (double)desenho->largura * desenho->altura;
+    return desenho->qtdVertices > 0 && area / desenho->qtdVertices > 400 ? 1 : 0;
+}
+
+static void pinta(tDesenho *desenho, int x, int y, int raio, tCor cor)
+{
+    for (int j = y - raio; j <= y + raio; j++)
+    {
+        if (j < 0 || j >= desenho->altura)
+            continue;
+        for (int i = x - raio; i <= x + raio; i++)
+        {
+            if (i < 0 || i >= desenho->largura)
+                continue;
+            unsigned char *p = &(desenho->pixels[3 * ((size_t)j * desenho->largura + i)]);
+            p[0] = cor.r;
+            p[1] = cor.g;
+            p[2] = cor.b;
+        }
+    }
+}
+
+// Bresenham
+static void linha(tDesenho *desenho, int x0, int y0, int x1, int y1, int raio, tCor cor)
+{
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int erro = dx + dy;
+
+    while (1)
+    {
+        pinta(desenho, x0, y0, raio, cor);
+        if (x0 == x1 && y0 == y1)
+            break;
+
+        int e2 = 2 * erro;
+        if (e2 >= dy)
+        {
+            erro += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            erro += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void linhaVertices(tDesenho *desenho, int a, int b, int raio, tCor cor)
+{
+    linha(desenho, desenho->px[a], desenho->py[a], desenho->px[b], desenho->py[b], raio, cor);
+}
+
+static void rasteriza(tDesenho *desenho)
+{
+    size_t tam = (size_t)3 * desenho->largura * desenho->altura;
+    int r = raioBase(desenho);
+
+    if (!desenho->pixels)
+        desenho->pixels = (unsigned char *)malloc(tam);
+    memset(desenho->pixels, 255, tam);
+
+    for (int i = 0; i < desenho->tamReferencia; i++)
+        linhaVertices(desenho, desenho->referencia[i], desenho->referencia[(i + 1) % desenho->tamReferencia], r, COR_REFERENCIA);
+
+    for (int i = 0; i < desenho->qtdMST; i++)
+        linhaVertices(desenho, getV1(desenho->MST[i]), getV2(desenho->MST[i]), 2 * r, COR_MST);
+
+    for (int i = 0; i < desenho->tamTour; i++)
+        linhaVertices(desenho, desenho->tour[i], desenho->tour[(i + 1) % desenho->tamTour], r, COR_TOUR);
+
+    for (int i = 0; i < desenho->qtdVertices; i++)
+        pinta(desenho, desenho->px[i], desenho->py[i], 2 * r, COR_CIDADE);
+}
+
+// ----------------------------- PPM ----------------------------- //
+
+static int salvaPPM(tDesenho *desenho, FILE *arq)
+{
+    size_t tam = (size_t)3 * desenho->largura * desenho->altura;
+
+    fprintf(arq, "P6\n%d %d\n255\n", desenho->largura, desenho->altura);
+    return fwrite(desenho->pixels, 1, tam, arq) == tam;
+}
+
+// ----------------------------- PNG ----------------------------- //
+
+// Saída de bits do deflate (LSB primeiro)
+typedef struct
+{
+    unsigned char *dados;
+    size_t qtd, cap;
+    unsigned int acumulador;
+    int bits;
+} tBits;
+
+static void escreveBits(tBits *s, unsigned int valor, int qtd)
+{
+    s->acumulador |= valor << s->bits;
+    s->bits += qtd;
+
+    while (s->bits >= 8)
+    {
+        if (s->qtd == s->cap)
+        {
+            s->cap *= 2;
+            s->dados = (unsigned char *)realloc(s->dados, s->cap);
+        }
+        s->dados[s->qtd++] = s->acumulador & 0xFF;
+        s->acumulador >>= 8;
+        s->bits -= 8;
+    }
+}
+
+// Códigos de Huffman são gravados a partir do bit mais significativo
+static void escreveCodigo(tBits *s, unsigned int codigo, int qtd)
+{
+    unsigned int invertido = 0;
+    for (int i = 0; i < qtd; i++)
+        invertido |= ((codigo >> i) & 1) << (qtd - 1 - i);
+    escreveBits(s, invertido, qtd);
+}
+
+// Símbolo literal/comprimento do Huffman fixo (RFC 1951, 3.2.6)
+static void escreveSimbolo(tBits *s, int simbolo)
+{
+    if (simbolo < 144)
+        escreveCodigo(s, 0x30 + simbolo, 8);
+    else if (simbolo < 256)
+        escreveCodigo(s, 0x190 + simbolo - 144, 9);
+    else if (simbolo < 280)
+        escreveCodigo(s, simbolo - 256, 7);
+    else
+        escreveCodigo(s, 0xC0 + simbolo - 280, 8);
+}
+
+static void escreveRepeticao(tBits *s, int comprimento)
+{
+    static const int base[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const int extras[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                   3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+    int c = 28;
+    while (base[c] > comprimento)
+        c--;
+
+    escreveSimbolo(s, 257 + c);
+    if (extras[c])
+        escreveBits(s, comprimento - base[c], extras[c]);
+
+    // Distância 1: código 0, 5 bits, sem extras
+    escreveCodigo(s, 0, 5);
+}
+
+/**
+ * @brief Comprime em um único bloco deflate de Huffman fixo
+ * @details Só procura repetições do byte anterior (distância 1): o fundo branco e as linhas
+ * retas viram poucas repetições longas, que é o que importa nesses desenhos.
+ */
+static void deflate(tBits *s, const unsigned char *dados, size_t tam)
+{
+    escreveBits(s, 1, 1); // Último bloco
+    escreveBits(s, 1, 2); // Huffman fixo
+
+    size_t i = 0;
+    while (i < tam)
+    {
+        size_t r = 0;
+        if (i > 0)
+            while (r < 258 && i + r < tam && dados[i + r] == dados[i - 1])
+                r++;
+
+        if (r >= 3)
+        {
+            escreveRepeticao(s, (int)r);
+            i += r;
+        }
+        else
+            escreveSimbolo(s, dados[i++]);
+    }
+
+    escreveSimbolo(s, 256);
+    escreveBits(s, 0, (8 - s->bits) % 8); // Completa o último byte
+}
+
+static unsigned int crc32(unsigned int crc, const unsigned char *dados, size_t tam)
+{
+    static unsigned int tabela[256];
+    static int pronta = 0;
+
+    if (!pronta)
+    {
+        for (unsigned int n = 0; n < 256; n++)
+        {
+            unsigned int c = n;
+            for (int k = 0; k < 8; k++)
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            tabela[n] = c;
+        }
+        pronta = 1;
+    }
+
+    crc = ~crc;
+    for (size_t i = 0; i < tam; i++)
+        crc = tabela[(crc ^ dados[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void escreve32(unsigned char *p, unsigned int v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static void escreveChunk(FILE *arq, const char *tipo, const unsigned char *dados, size_t tam)
+{
+    unsigned char aux[4];
+
+    escreve32(aux, (unsigned int)tam);
+    fwrite(aux, 1, 4, arq);
+    fwrite(tipo, 1, 4, arq);
+    if (tam)
+        fwrite(dados, 1, tam, arq);
+
+    unsigned int crc = crc32(0, (const unsigned char *)tipo, 4);
+    crc = crc32(crc, dados, tam);
+    escreve32(aux, crc);
+    fwrite(aux, 1, 4, arq);
+}
+
+static int salvaPNG(tDesenho *desenho, FILE *arq)
+{
+    static const unsigned char assinatura[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    size_t linha = (size_t)3 * desenho->largura;
+
+    // Linhas com o byte de filtro 0 (nenhum) na frente
+    size_t tam = (linha + 1) * desenho->altura;
+    unsigned char *cru = (unsigned char *)malloc(tam);
+    for (int y = 0; y < desenho->altura; y++)
+    {
+        cru[y * (linha + 1)] = 0;
+        memcpy(&cru[y * (linha + 1) + 1], &(desenho->pixels[y * linha]), linha);
+    }
+
+    // zlib: cabeçalho, deflate e adler32
+    tBits s = {NULL, 0, 1024, 0, 0};
+    s.dados = (unsigned char *)malloc(s.cap);
+    escreveBits(&s, 0x78, 8);
+    escreveBits(&s, 0x01, 8);
+    deflate(&s, cru, tam);
+
+    unsigned int a = 1, b = 0;
+    for (size_t i = 0; i < tam; i++)
+    {
+        a = (a + cru[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    unsigned int adler = (b << 16) | a;
+    for (int k = 3; k >= 0; k--)
+        escreveBits(&s, (adler >> (8 * k)) & 0xFF, 8);
+
+    unsigned char ihdr[13];
+    escreve32(ihdr, desenho->largura);
+    escreve32(ihdr + 4, desenho->altura);
+    ihdr[8] = 8;  // Bits por canal
+    ihdr[9] = 2;  // RGB
+    ihdr[10] = 0; // Deflate
+    ihdr[11] = 0; // Filtros padrão
+    ihdr[12] = 0; // Sem entrelaçamento
+
+    fwrite(assinatura, 1, 8, arq);
+    escreveChunk(arq, "IHDR", ihdr, 13);
+    escreveChunk(arq, "IDAT", s.dados, s.qtd);
+    escreveChunk(arq, "IEND", NULL, 0);
+
+    free(s.dados);
+    free(cru);
+
+    return !ferror(arq);
+}
+
+// ----------------------------- SVG ----------------------------- //
+
+// Uma camada de segmentos como path único: M absoluto no início de cada traço, l relativo depois
+static void pathSVG(tDesenho *desenho, FILE *arq, int *ordem, int tam, const char *cor, int espessura)
+{
+    if (tam < 2)
+        return;
+
+    fprintf(arq, "<path fill=\"none\" stroke=\"%s\" stroke-width=\"%d\" d=\"M%d %d", cor, espessura,
+            desenho->px[ordem[0]], desenho->py[ordem[0]]);
+    for (int i = 1; i < tam; i++)
+        fprintf(arq, "l%d %d", desenho->px[ordem[i]] - desenho->px[ordem[i - 1]],
+                desenho->py[ordem[i]] - desenho->py[ordem[i - 1]]);
+    fprintf(arq, "z\"/>\n");
+}
+
+static int salvaSVG(tDesenho *desenho, FILE *arq)
+{
+    int r = raioBase(desenho);
+    int *px = desenho->px, *py = desenho->py;
+
+    fprintf(arq, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\" viewBox=\"0 0 %d %d\">\n",
+            desenho->largura, desenho->altura, desenho->largura, desenho->altura);
+    fprintf(arq, "<rect width=\"100%%\" height=\"100%%\" fill=\"white\"/>\n");
+
+    pathSVG(desenho, arq, desenho->referencia, desenho->tamReferencia, "#3caa3c", 2 * r + 1);
+
+    if (desenho->qtdMST > 0)
+    {
+        fprintf(arq, "<path fill=\"none\" stroke=\"#6edce6\" stroke-width=\"%d\" d=\"", 4 * r + 1);
+        for (int i = 0; i < desenho->qtdMST; i++)
+        {
+            int a = getV1(desenho->MST[i]), b = getV2(desenho->MST[i]);
+            fprintf(arq, "M%d %dl%d %d", px[a], py[a], px[b] - px[a], py[b] - py[a]);
+        }
+        fprintf(arq, "\"/>\n");
+    }
+
+    pathSVG(desenho, arq, desenho->tour, desenho->tamTour, "#dc1e1e", 2 * r + 1);
+
+    // Cidades como traços de comprimento zero com ponta redonda
+    if (desenho->qtdVertices > 0)
+    {
+        fprintf(arq, "<path stroke=\"black\" stroke-linecap=\"round\" stroke-width=\"%d\" d=\"", 4 * r + 2);
+        for (int i = 0; i < desenho->qtdVertices; i++)
+            fprintf(arq, "M%d %dh0", px[i], py[i]);
+        fprintf(arq, "\"/>\n");
+    }
+
+    fprintf(arq, "</svg>\n");
+
+    return !ferror(arq);
+}
+
+int salvaDesenho(tDesenho *desenho, const char *caminho)
+{
+    const char *ext = strrchr(caminho, '.');
+    int formato;
+
+    if (!ext)
+        return 0;
+    else if (!strcmp(ext, ".ppm"))
+        formato = 0;
+    else if (!strcmp(ext, ".png"))
+        formato = 1;
+    else if (!strcmp(ext, ".svg"))
+        formato = 2;
+    else
+        return 0;
+
+    FILE *arq = fopen(caminho, "wb");
+    if (!arq)
+        return 0;
+
+    int ok;
+    if (formato == 2)
+        ok = salvaSVG(desenho, arq);
+    else
+    {
+        rasteriza(desenho);
+        ok = formato == 0 ? salvaPPM(desenho, arq) : salvaPNG(desenho, arq);
+    }
+
+    return fclose(arq) == 0 && ok;
+}
@@ -0,0 +1,68 @@
+#ifndef DESENHO_H
+#define DESENHO_H
+
+#include "grafo.h"
+
+typedef struct stDesenho tDesenho;
+
+// Funções inicializadoras e liberadoras
+
+/**
+ * @brief Cria um desenho da instância, substituto nativo do tsp_plot.py
+ * @details A altura sai da proporção da caixa envolvente dos vértices. As camadas (referência,
+ * MST, tour e cidades) só guardam ponteiros: os vetores precisam existir até salvaDesenho.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param largura Largura da imagem em pixels
+ * @return tDesenho*
+ */
+tDesenho *initDesenho(tGrafo *grafo, int largura);
+
+/**
+ * @brief Destrói o desenho (as camadas não são liberadas)
+ *
+ * @param desenho Desenho a ser liberado
+ */
+void freeDesenho(tDesenho *desenho);
+
+// Funções gerais
+
+/**
+ * @brief Define a MST desenhada (em ciano, por baixo do tour)
+ *
+ * @param desenho Desenho
+ * @param MST Vetor de arestas
+ * @param qtd Quantidade de arestas
+ */
+void setMSTDesenho(tDesenho *desenho, tAresta **MST, int qtd);
+
+/**
+ * @brief Define o tour desenhado (em vermelho)
+ *
+ * @param desenho Desenho
+ * @param tour Ordem de visita, índices a partir de 0
+ * @param tam Quantidade de cidades
+ */
+void setTourDesenho(tDesenho *desenho, int *tour, int tam);
+
+/**
+ * @brief Define o tour de referência (em verde, por baixo de tudo), p.ex. o de exemplos/opt
+ *
+ * @param desenho Desenho
+ * @param tour Ordem de visita, índices a partir de 0
+ * @param tam Quantidade de cidades
+ */
+void setReferenciaDesenho(tDesenho *desenho, int *tour, int tam);
+
+/**
+ * @brief Salva o desenho no formato indicado pela extensão do caminho
+ * @details .ppm e .png são rasterizados (PNG com deflate próprio, sem zlib); .svg grava cada
+ * camada como um único path com coordenadas inteiras relativas.
+ *
+ * @param desenho Desenho
+ * @param caminho Arquivo de saída (.ppm, .png ou .svg)
+ * @return int 1 se salvou, 0 se a extensão é desconhecida ou o arquivo não abriu
+ */
+int salvaDesenho(tDesenho *desenho, const char *caminho);
+
+#endif
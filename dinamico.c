@@ -0,0 +1,941 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dinamico.h"
+#include "grade.h"
+
+#define VIZINHOS_DINAMICO 8      // Vizinhos usados na inserção no tour e no 2-opt local
+#define MAX_TRECHO_DINAMICO 1000 // Maior trecho do tour que o 2-opt local aceita inverter
+#define MAX_MELHORIAS_DINAMICO 64
+
+struct stDinamico
+{
+    // Vértices
+    int qtdIds, capIds, qtdAtivos;
+    float *xs, *ys;
+    char *ativo;
+    int *noVertice;  // Nó da link-cut tree de cada vértice
+    int *incidencia; // Primeira incidência (2 * aresta + lado) do vértice, ou -1
+    int *prox, *ant; // Tour como lista duplamente encadeada
+    int *carimbo, *componente; // Marcas da busca que religa a MST na remoção
+    int carimboAtual;
+    tGrade *grade;
+
+    // Arestas da MST
+    int capArestas, qtdArestas;
+    int *eu, *ev;
+    float *ew;
+    int *eNo;
+    int *proxInc; // Próxima incidência na lista do vértice (2 posições por aresta)
+    char *emUso;
+    int *arestasLivres, qtdArestasLivres;
+    double pesoMST;
+
+    // Link-cut tree: vértices e arestas são nós; o valor dos vértices é -1
+    int capNos, qtdNos;
+    int *filho; // 2 posições por nó: esquerda e direita da splay
+    int *pai;   // Pai na splay ou, na raiz da splay, pai do caminho
+    char *inv;
+    float *val;
+    int *maxNo;      // Nó de maior valor na subárvore da splay
+    int *arestaDoNo; // Aresta representada pelo nó, ou -1
+    int *pilha;
+    int *nosLivres, qtdNosLivres;
+};
+
+// Busca em largura de uma subárvore, feita aos poucos (intercalada com as outras)
+typedef struct
+{
+    int *fila;
+    int inicio, fim, capacidade;
+    int terminou;
+} tBuscaSubarvore;
+
+// Aresta candidata a religar a MST
+typedef struct
+{
+    float peso;
+    int a, b;
+} tCandidataMST;
+
+static float distDin(tDinamico *d, int a, int b)
+{
+    float x = d->xs[a] - d->xs[b];
+    float y = d->ys[a] - d->ys[b];
+
+    return sqrtf(x * x + y * y);
+}
+
+// -------------------------- Link-cut tree -------------------------- //
+
+static int ehRaizSplay(tDinamico *d, int x)
+{
+    int p = d->pai[x];
+    return p < 0 || (d->filho[2 * p] != x && d->filho[2 * p + 1] != x);
+}
+
+static void atualizaNo(tDinamico *d, int x)
+{
+    int m = x;
+
+    for (int lado = 0; lado < 2; lado++)
+    {
+        int c = d->filho[2 * x + lado];
+        if (c >= 0 && d->val[d->maxNo[c]] > d->val[m])
+            m = d->maxNo[c];
+    }
+
+    d->maxNo[x] = m;
+}
+
+static void empurraNo(tDinamico *d, int x)
+{
+    if (!d->inv[x])
+        return;
+
+    int aux = d->filho[2 * x];
+    d->filho[2 * x] = d->filho[2 * x + 1];
+    d->filho[2 * x + 1] = aux;
+
+    for (int lado = 0; lado < 2; lado++)
+        if (d->filho[2 * x + lado] >= 0)
+            d->inv[d->filho[2 * x + lado]] ^= 1;
+
+    d->inv[x] = 0;
+}
+
+static void rotaciona(tDinamico *d, int x)
+{
+    int p = d->pai[x];
+    int g = d->pai[p];
+    int lado = d->filho[2 * p + 1] == x;
+
+    if (!ehRaizSplay(d, p))
+    {
+        if (d->filho[2 * g] == p)
+            d->filho[2 * g] = x;
+        else
+            d->filho[2 * g + 1] = x;
+    }
+    d->pai[x] = g;
+
+    int b = d->filho[2 * x + !lado];
+    d->filho[2 * p + lado] = b;
+    if (b >= 0)
+        d->pai[b] = p;
+
+    d->filho[2 * x + !lado] = p;
+    d->pai[p] = x;
+
+    atualizaNo(d, p);
+    atualizaNo(d, x);
+}
+
+static void splay(tDinamico *d, int x)
+{
+    // Desce as inversões pendentes da raiz da splay até x
+    int topo = 0;
+    int y = x;
+    d->pilha[topo++] = y;
+    while (!ehRaizSplay(d, y))
+    {
+        y = d->pai[y];
+        d->pilha[topo++] = y;
+    }
+    while (topo > 0)
+        empurraNo(d, d->pilha[--topo]);
+
+    while (!ehRaizSplay(d, x))
+    {
+        int p = d->pai[x];
+        if (!ehRaizSplay(d, p))
+        {
+            int g = d->pai[p];
+            if ((d->filho[2 * g] == p) == (d->filho[2 * p] == x))
+                rotaciona(d, p);
+            else
+                rotaciona(d, x);
+        }
+        rotaciona(d, x);
+    }
+}
+
+static void acessa(tDinamico *d, int x)
+{
+    int ultimo = -1;
+
+    for (int y = x; y >= 0; y = d->pai[y])
+    {
+        splay(d, y);
+        d->filho[2 * y + 1] = ultimo;
+        atualizaNo(d, y);
+        ultimo = y;
+    }
+
+    splay(d, x);
+}
+
+static void tornaRaiz(tDinamico *d, int x)
+{
+    acessa(d, x);
+    d->inv[x] ^= 1;
+}
+
+static int achaRaiz(tDinamico *d, int x)
+{
+    acessa(d, x);
+
+    while (1)
+    {
+        empurraNo(d, x);
+        if (d->filho[2 * x] < 0)
+            break;
+        x = d->filho[2 * x];
+    }
+
+    splay(d, x);
+    return x;
+}
+
+static void ligaNos(tDinamico *d, int u, int v)
+{
+    tornaRaiz(d, u);
+    d->pai[u] = v;
+}
+
+static void cortaNos(tDinamico *d, int u, int v)
+{
+    tornaRaiz(d, u);
+    acessa(d, v);
+
+    // O caminho é só u-v, então u é o filho esquerdo de v
+    d->filho[2 * v] = -1;
+    d->pai[u] = -1;
+    atualizaNo(d, v);
+}
+
+static int conectados(tDinamico *d, int a, int b)
+{
+    return achaRaiz(d, d->noVertice[a]) == achaRaiz(d, d->noVertice[b]);
+}
+
+// Nó (aresta) de maior peso no caminho da MST entre os vértices a e b
+static int maiorNoCaminho(tDinamico *d, int a, int b)
+{
+    tornaRaiz(d, d->noVertice[a]);
+    acessa(d, d->noVertice[b]);
+
+    return d->maxNo[d->noVertice[b]];
+}
+
+static int novoNo(tDinamico *d, float valor, int aresta)
+{
+    int x;
+
+    if (d->qtdNosLivres > 0)
+        x = d->nosLivres[--d->qtdNosLivres];
+    else
+    {
+        if (d->qtdNos == d->capNos)
+        {
+            d->capNos *= 2;
+            d->filho = (int *)realloc(d->filho, 2 * d->capNos * sizeof(int));
+            d->pai = (int *)realloc(d->pai, d->capNos * sizeof(int));
+            d->inv = (char *)realloc(d->inv, d->capNos * sizeof(char));
+            d->val = (float *)realloc(d->val, d->capNos * sizeof(float));
+            d->maxNo = (int *)realloc(d->maxNo, d->capNos * sizeof(int));
+            d->arestaDoNo = (int *)realloc(d->arestaDoNo, d->capNos * sizeof(int));
+            d->pilha = (int *)realloc(d->pilha, d->capNos * sizeof(int));
+            d->nosLivres = (int *)realloc(d->nosLivres, d->capNos * sizeof(int));
+        }
+        x = d->qtdNos++;
+    }
+
+    d->filho[2 * x] = d->filho[2 * x + 1] = -1;
+    d->pai[x] = -1;
+    d->inv[x] = 0;
+    d->val[x] = valor;
+    d->maxNo[x] = x;
+    d->arestaDoNo[x] = aresta;
+
+    return x;
+}
+
+// ---------------------------- Arestas da MST ---------------------------- //
+
+static void adicionaArestaMST(tDinamico *d, int a, int b)
+{
+    int e;
+
+    if (d->qtdArestasLivres > 0)
+        e = d->arestasLivres[--d->qtdArestasLivres];
+    else
+    {
+        if (d->qtdArestas == d->capArestas)
+        {
+            d->capArestas *= 2;
+            d->eu = (int *)realloc(d->eu, d->capArestas * sizeof(int));
+            d->ev = (int *)realloc(d->ev, d->capArestas * sizeof(int));
+            d->ew = (float *)realloc(d->ew, d->capArestas * sizeof(float));
+            d->eNo = (int *)realloc(d->eNo, d->capArestas * sizeof(int));
+            d->proxInc = (int *)realloc(d->proxInc, 2 * d->capArestas * sizeof(int));
+            d->emUso = (char *)realloc(d->emUso, d->capArestas * sizeof(char));
+            d->arestasLivres = (int *)realloc(d->arestasLivres, d->capArestas * sizeof(int));
+        }
+        e = d->qtdArestas++;
+    }
+
+    d->eu[e] = a;
+    d->ev[e] = b;
+    d->ew[e] = distDin(d, a, b);
+    d->emUso[e] = 1;
+    d->eNo[e] = novoNo(d, d->ew[e], e);
+
+    ligaNos(d, d->noVertice[a], d->eNo[e]);
+    ligaNos(d, d->eNo[e], d->noVertice[b]);
+
+    d->proxInc[2 * e] = d->incidencia[a];
+    d->incidencia[a] = 2 * e;
+    d->proxInc[2 * e + 1] = d->incidencia[b];
+    d->incidencia[b] = 2 * e + 1;
+
+    d->pesoMST += d->ew[e];
+}
+
+static void tiraIncidencia(tDinamico *d, int v, int slot)
+{
+    int *p = &(d->incidencia[v]);
+
+    while (*p != slot)
+        p = &(d->proxInc[*p]);
+    *p = d->proxInc[slot];
+}
+
+static void removeArestaMST(tDinamico *d, int e)
+{
+    cortaNos(d, d->noVertice[d->eu[e]], d->eNo[e]);
+    cortaNos(d, d->eNo[e], d->noVertice[d->ev[e]]);
+
+    tiraIncidencia(d, d->eu[e], 2 * e);
+    tiraIncidencia(d, d->ev[e], 2 * e + 1);
+
+    d->nosLivres[d->qtdNosLivres++] = d->eNo[e];
+    d->arestasLivres[d->qtdArestasLivres++] = e;
+    d->emUso[e] = 0;
+    d->pesoMST -= d->ew[e];
+}
+
+// Aresta (a,b) entra no lugar da maior aresta do ciclo, se for mais leve que ela
+static void ofereceArestaMST(tDinamico *d, int a, int b)
+{
+    if (!conectados(d, a, b))
+    {
+        adicionaArestaMST(d, a, b);
+        return;
+    }
+
+    int maior = maiorNoCaminho(d, a, b);
+    if (d->val[maior] > distDin(d, a, b))
+    {
+        removeArestaMST(d, d->arestaDoNo[maior]);
+        adicionaArestaMST(d, a, b);
+    }
+}
+
+// -------------------------------- Tour -------------------------------- //
+
+// Passos de "de" até "alvo" seguindo prox, ou -1 se passar do limite
+static int distanciaAdiante(tDinamico *d, int de, int alvo)
+{
+    for (int passos = 0; passos <= MAX_TRECHO_DINAMICO; passos++)
+    {
+        if (de == alvo)
+            return passos;
+        de = d->prox[de];
+    }
+
+    return -1;
+}
+
+// Inverte o caminho b..c (seguindo prox): a->b ... c->e vira a->c ... b->e
+static void inverteCaminho(tDinamico *d, int b, int c)
+{
+    int a = d->ant[b];
+    int e = d->prox[c];
+    int x = b;
+
+    while (1)
+    {
+        int seguinte = d->prox[x];
+        d->prox[x] = d->ant[x];
+        d->ant[x] = seguinte;
+        if (x == c)
+            break;
+        x = seguinte;
+    }
+
+    d->prox[a] = c;
+    d->ant[c] = a;
+    d->prox[b] = e;
+    d->ant[e] = b;
+}
+
+/**
+ * @brief Troca (x, prox x), (z, prox z) por (x, z), (prox x, prox z)
+ * @return 1 se conseguiu, 0 se os dois lados do ciclo são maiores que MAX_TRECHO_DINAMICO
+ */
+static int trocaDoisOpt(tDinamico *d, int x, int z)
+{
+    int y = d->prox[x];
+    int w = d->prox[z];
+
+    if (distanciaAdiante(d, y, z) >= 0)
+        inverteCaminho(d, y, z);
+    else if (distanciaAdiante(d, w, x) >= 0)
+        inverteCaminho(d, w, x);
+    else
+        return 0;
+
+    return 1;
+}
+
+static int naFila(int *fila, int qtd, int v)
+{
+    for (int i = 0; i < qtd; i++)
+        if (fila[i] == v)
+            return 1;
+    return 0;
+}
+
+// 2-opt só em volta dos vértices afetados, com quantidade de trocas limitada
+static void doisOptLocal(tDinamico *d, int *sementes, int qtdSementes)
+{
+    int fila[4 * MAX_MELHORIAS_DINAMICO + 8];
+    int inicio = 0, qtd = 0, melhorias = 0;
+    int viz[VIZINHOS_DINAMICO];
+
+    if (d->qtdAtivos < 5)
+        return;
+
+    for (int i = 0; i < qtdSementes; i++)
+        if (!naFila(fila, qtd, sementes[i]))
+            fila[qtd++] = sementes[i];
+
+    while (inicio < qtd && melhorias < MAX_MELHORIAS_DINAMICO)
+    {
+        int a = fila[inicio++];
+        int k = buscaVizinhosGrade(d->grade, d->xs[a], d->ys[a], VIZINHOS_DINAMICO, a, viz);
+        int trocou = 0;
+
+        for (int direcao = 0; direcao < 2 && !trocou; direcao++)
+        {
+            int b = direcao == 0 ? d->prox[a] : d->ant[a];
+            float dab = distDin(d, a, b);
+
+            for (int i = 0; i < k && !trocou; i++)
+            {
+                int c = viz[i];
+                float dac = distDin(d, a, c);
+                if (dac >= dab)
+                    break;
+
+                int e = direcao == 0 ? d->prox[c] : d->ant[c];
+                if (c == b || e == a)
+                    continue;
+
+                if (dac + distDin(d, b, e) - dab - distDin(d, c, e) < -1e-4f)
+                {
+                    trocou = direcao == 0 ? trocaDoisOpt(d, a, c) : trocaDoisOpt(d, b, e);
+                    if (trocou)
+                    {
+                        int tocados[4] = {a, b, c, e};
+                        for (int t = 0; t < 4; t++)
+                            if (!naFila(fila + inicio, qtd - inicio, tocados[t]) && qtd < (int)(sizeof(fila) / sizeof(int)))
+                                fila[qtd++] = tocados[t];
+                        melhorias++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ------------------------------ Vértices ------------------------------ //
+
+static int novoVertice(tDinamico *d, float x, float y)
+{
+    if (d->qtdIds == d->capIds)
+    {
+        d->capIds *= 2;
+        d->xs = (float *)realloc(d->xs, d->capIds * sizeof(float));
+        d->ys = (float *)realloc(d->ys, d->capIds * sizeof(float));
+        d->ativo = (char *)realloc(d->ativo, d->capIds * sizeof(char));
+        d->noVertice = (int *)realloc(d->noVertice, d->capIds * sizeof(int));
+        d->incidencia = (int *)realloc(d->incidencia, d->capIds * sizeof(int));
+        d->prox = (int *)realloc(d->prox, d->capIds * sizeof(int));
+        d->ant = (int *)realloc(d->ant, d->capIds * sizeof(int));
+        d->carimbo = (int *)realloc(d->carimbo, d->capIds * sizeof(int));
+        d->componente = (int *)realloc(d->componente, d->capIds * sizeof(int));
+    }
+
+    int id = d->qtdIds++;
+    d->xs[id] = x;
+    d->ys[id] = y;
+    d->ativo[id] = 1;
+    d->incidencia[id] = -1;
+    d->noVertice[id] = novoNo(d, -1, -1);
+    d->prox[id] = d->ant[id] = id;
+    d->carimbo[id] = 0;
+    d->qtdAtivos++;
+
+    return id;
+}
+
+tDinamico *initDinamico(tGrafo *grafo, tAresta **MST, int *tour)
+{
+    int n = getSizeVertices(grafo);
+    int cap = n > 16 ? n : 16;
+    tDinamico *d = (tDinamico *)calloc(1, sizeof(tDinamico));
+
+    d->capIds = cap;
+    d->xs = (float *)malloc(cap * sizeof(float));
+    d->ys = (float *)malloc(cap * sizeof(float));
+    d->ativo = (char *)malloc(cap * sizeof(char));
+    d->noVertice = (int *)malloc(cap * sizeof(int));
+    d->incidencia = (int *)malloc(cap * sizeof(int));
+    d->prox = (int *)malloc(cap * sizeof(int));
+    d->ant = (int *)malloc(cap * sizeof(int));
+    d->carimbo = (int *)malloc(cap * sizeof(int));
+    d->componente = (int *)malloc(cap * sizeof(int));
+
+    d->capArestas = cap;
+    d->eu = (int *)malloc(cap * sizeof(int));
+    d->ev = (int *)malloc(cap * sizeof(int));
+    d->ew = (float *)malloc(cap * sizeof(float));
+    d->eNo = (int *)malloc(cap * sizeof(int));
+    d->proxInc = (int *)malloc(2 * cap * sizeof(int));
+    d->emUso = (char *)malloc(cap * sizeof(char));
+    d->arestasLivres = (int *)malloc(cap * sizeof(int));
+
+    d->capNos = 2 * cap;
+    d->filho = (int *)malloc(2 * d->capNos * sizeof(int));
+    d->pai = (int *)malloc(d->capNos * sizeof(int));
+    d->inv = (char *)malloc(d->capNos * sizeof(char));
+    d->val = (float *)malloc(d->capNos * sizeof(float));
+    d->maxNo = (int *)malloc(d->capNos * sizeof(int));
+    d->arestaDoNo = (int *)malloc(d->capNos * sizeof(int));
+    d->pilha = (int *)malloc(d->capNos * sizeof(int));
+    d->nosLivres = (int *)malloc(d->capNos * sizeof(int));
+
+    // Células do tamanho do espaçamento médio entre pontos
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        if (i == 0 || getX(v) < minX)
+            minX = getX(v);
+        if (i == 0 || getX(v) > maxX)
+            maxX = getX(v);
+        if (i == 0 || getY(v) < minY)
+            minY = getY(v);
+        if (i == 0 || getY(v) > maxY)
+            maxY = getY(v);
+    }
+    float area = (maxX - minX) * (maxY - minY);
+    float tamCelula = n > 0 && area > 0 ? sqrtf(area / n) : 1;
+    d->grade = initGrade(tamCelula);
+
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        novoVertice(d, getX(v), getY(v));
+        insereGrade(d->grade, i, getX(v), getY(v));
+    }
+
+    for (int i = 0; i < n - 1; i++)
+        adicionaArestaMST(d, getV1(MST[i]), getV2(MST[i]));
+
+    for (int i = 0; i < n; i++)
+    {
+        d->prox[tour[i]] = tour[(i + 1) % n];
+        d->ant[tour[(i + 1) % n]] = tour[i];
+    }
+
+    return d;
+}
+
+void freeDinamico(tDinamico *d)
+{
+    freeGrade(d->grade);
+
+    free(d->xs);
+    free(d->ys);
+    free(d->ativo);
+    free(d->noVertice);
+    free(d->incidencia);
+    free(d->prox);
+    free(d->ant);
+    free(d->carimbo);
+    free(d->componente);
+
+    free(d->eu);
+    free(d->ev);
+    free(d->ew);
+    free(d->eNo);
+    free(d->proxInc);
+    free(d->emUso);
+    free(d->arestasLivres);
+
+    free(d->filho);
+    free(d->pai);
+    free(d->inv);
+    free(d->val);
+    free(d->maxNo);
+    free(d->arestaDoNo);
+    free(d->pilha);
+    free(d->nosLivres);
+
+    free(d);
+}
+
+// Coloca o vértice (já criado) na grade, na MST e no tour
+static void encaixaVertice(tDinamico *d, int v)
+{
+    int cones[8];
+    buscaConesGrade(d->grade, d->xs[v], d->ys[v], v, cones);
+
+    // MST: as arestas novas da MST euclidiana estão entre os vizinhos de Yao de v, e cada uma
+    // só pode trocar a maior aresta do ciclo que fecha
+    for (int s = 0; s < 8; s++)
+        if (cones[s] >= 0)
+            ofereceArestaMST(d, v, cones[s]);
+
+    int viz[VIZINHOS_DINAMICO];
+    int k = buscaVizinhosGrade(d->grade, d->xs[v], d->ys[v], VIZINHOS_DINAMICO, v, viz);
+
+    insereGrade(d->grade, v, d->xs[v], d->ys[v]);
+
+    if (k == 0)
+        return;
+
+    // Tour: inserção mais barata entre arestas que tocam os vizinhos
+    int melhorA = viz[0];
+    float melhorCusto = HUGE_VALF;
+    for (int i = 0; i < k; i++)
+    {
+        int a = viz[i];
+        int pontas[2] = {d->ant[a], a};
+
+        for (int j = 0; j < 2; j++)
+        {
+            int x = pontas[j], y = d->prox[pontas[j]];
+            float custo = distDin(d, x, v) + distDin(d, v, y) - distDin(d, x, y);
+            if (custo < melhorCusto)
+            {
+                melhorCusto = custo;
+                melhorA = x;
+            }
+        }
+    }
+
+    int b = d->prox[melhorA];
+    d->prox[melhorA] = v;
+    d->ant[v] = melhorA;
+    d->prox[v] = b;
+    d->ant[b] = v;
+
+    int sementes[3] = {v, melhorA, b};
+    doisOptLocal(d, sementes, 3);
+}
+
+static int compCandidataMST(const void *p1, const void *p2)
+{
+    const tCandidataMST *a = (const tCandidataMST *)p1;
+    const tCandidataMST *b = (const tCandidataMST *)p2;
+
+    return (a->peso > b->peso) - (a->peso < b->peso);
+}
+
+/**
+ * @brief Religa as subárvores que ficaram soltas quando um vértice saiu da MST
+ * @details Percorre as subárvores em largura, intercaladas, até só sobrar uma sem terminar (a maior),
+ * que não é visitada inteira. Toda aresta da nova MST entre subárvores tem uma ponta em alguma das
+ * menores e é vizinha de Yao dessa ponta, então Kruskal sobre essas candidatas dá a MST exata,
+ * com custo proporcional ao tamanho das subárvores menores.
+ */
+static void religaMST(tDinamico *d, int *raizes, int qtd)
+{
+    tBuscaSubarvore buscas[64];
+    int carimbo = ++d->carimboAtual;
+    int abertas = qtd;
+
+    for (int c = 0; c < qtd; c++)
+    {
+        buscas[c].capacidade = 16;
+        buscas[c].fila = (int *)malloc(buscas[c].capacidade * sizeof(int));
+        buscas[c].fila[0] = raizes[c];
+        buscas[c].inicio = 0;
+        buscas[c].fim = 1;
+        buscas[c].terminou = 0;
+        d->carimbo[raizes[c]] = carimbo;
+        d->componente[raizes[c]] = c;
+    }
+
+    while (abertas > 1)
+    {
+        for (int c = 0; c < qtd && abertas > 1; c++)
+        {
+            tBuscaSubarvore *busca = &buscas[c];
+            if (busca->terminou)
+                continue;
+
+            if (busca->inicio == busca->fim)
+            {
+                busca->terminou = 1;
+                abertas--;
+                continue;
+            }
+
+            int x = busca->fila[busca->inicio++];
+            for (int inc = d->incidencia[x]; inc >= 0; inc = d->proxInc[inc])
+            {
+                int e = inc / 2;
+                int y = d->eu[e] == x ? d->ev[e] : d->eu[e];
+                if (d->carimbo[y] == carimbo)
+                    continue;
+
+                d->carimbo[y] = carimbo;
+                d->componente[y] = c;
+                if (busca->fim == busca->capacidade)
+                {
+                    busca->capacidade *= 2;
+                    busca->fila = (int *)realloc(busca->fila, busca->capacidade * sizeof(int));
+                }
+                busca->fila[busca->fim++] = y;
+            }
+        }
+    }
+
+    int capCandidatas = 64, qtdCandidatas = 0;
+    tCandidataMST *candidatas = (tCandidataMST *)malloc(capCandidatas * sizeof(tCandidataMST));
+    int cones[8];
+
+    for (int c = 0; c < qtd; c++)
+    {
+        if (!buscas[c].terminou)
+            continue;
+
+        for (int i = 0; i < buscas[c].fim; i++)
+        {
+            int u = buscas[c].fila[i];
+            buscaConesGrade(d->grade, d->xs[u], d->ys[u], u, cones);
+
+            for (int s = 0; s < 8; s++)
+            {
+                int t = cones[s];
+                if (t < 0 || (d->carimbo[t] == carimbo && d->componente[t] == c))
+                    continue;
+
+                if (qtdCandidatas == capCandidatas)
+                {
+                    capCandidatas *= 2;
+                    candidatas = (tCandidataMST *)realloc(candidatas, capCandidatas * sizeof(tCandidataMST));
+                }
+                candidatas[qtdCandidatas].peso = distDin(d, u, t);
+                candidatas[qtdCandidatas].a = u;
+                candidatas[qtdCandidatas].b = t;
+                qtdCandidatas++;
+            }
+        }
+    }
+
+    qsort(candidatas, qtdCandidatas, sizeof(tCandidataMST), compCandidataMST);
+
+    int faltam = qtd - 1;
+    for (int i = 0; i < qtdCandidatas && faltam > 0; i++)
+    {
+        if (!conectados(d, candidatas[i].a, candidatas[i].b))
+        {
+            adicionaArestaMST(d, candidatas[i].a, candidatas[i].b);
+            faltam--;
+        }
+    }
+
+    free(candidatas);
+    for (int c = 0; c < qtd; c++)
+        free(buscas[c].fila);
+}
+
+// Tira o vértice da grade, do tour e da MST (religando as subárvores)
+static void desencaixaVertice(tDinamico *d, int v)
+{
+    removeGrade(d->grade, v, d->xs[v], d->ys[v]);
+
+    int p = d->ant[v], s = d->prox[v];
+    d->prox[p] = s;
+    d->ant[s] = p;
+    d->prox[v] = d->ant[v] = v;
+
+    // Antigos vizinhos na MST: cada um ficou em uma subárvore diferente
+    int exVizinhos[64], qtdEx = 0;
+    while (d->incidencia[v] >= 0)
+    {
+        int e = d->incidencia[v] / 2;
+        if (qtdEx < 64)
+            exVizinhos[qtdEx++] = d->eu[e] == v ? d->ev[e] : d->eu[e];
+        removeArestaMST(d, e);
+    }
+
+    if (qtdEx > 1)
+        religaMST(d, exVizinhos, qtdEx);
+
+    int sementes[2] = {p, s};
+    if (d->qtdAtivos > 1)
+        doisOptLocal(d, sementes, 2);
+}
+
+int insereVerticeDinamico(tDinamico *d, float x, float y)
+{
+    int v = novoVertice(d, x, y);
+
+    encaixaVertice(d, v);
+
+    return v;
+}
+
+int removeVerticeDinamico(tDinamico *d, int id)
+{
+    if (id < 0 || id >= d->qtdIds || !d->ativo[id])
+        return 0;
+
+    d->qtdAtivos--;
+    d->ativo[id] = 0;
+    desencaixaVertice(d, id);
+
+    return 1;
+}
+
+int moveVerticeDinamico(tDinamico *d, int id, float x, float y)
+{
+    if (id < 0 || id >= d->qtdIds || !d->ativo[id])
+        return 0;
+
+    // Sai do lugar com o tamanho antigo do tour, e volta na posição nova
+    d->qtdAtivos--;
+    desencaixaVertice(d, id);
+    d->qtdAtivos++;
+
+    d->xs[id] = x;
+    d->ys[id] = y;
+    encaixaVertice(d, id);
+
+    return 1;
+}
+
+int getQtdAtivosDinamico(tDinamico *d)
+{
+    return d->qtdAtivos;
+}
+
+int getQtdIdsDinamico(tDinamico *d)
+{
+    return d->qtdIds;
+}
+
+int getVerticeDinamico(tDinamico *d, int id, float *x, float *y)
+{
+    if (id < 0 || id >= d->qtdIds || !d->ativo[id])
+        return 0;
+
+    if (x)
+        *x = d->xs[id];
+    if (y)
+        *y = d->ys[id];
+
+    return 1;
+}
+
+double getPesoMSTDinamico(tDinamico *d)
+{
+    return d->pesoMST;
+}
+
+double pesoMSTExatoDinamico(tDinamico *d)
+{
+    double *custo = (double *)malloc(d->qtdIds * sizeof(double));
+    char *fora = (char *)malloc(d->qtdIds * sizeof(char));
+    int atual = -1;
+
+    for (int i = 0; i < d->qtdIds; i++)
+    {
+        custo[i] = HUGE_VAL;
+        fora[i] = d->ativo[i];
+        if (d->ativo[i] && atual < 0)
+            atual = i;
+    }
+
+    double peso = 0;
+    for (int passo = 1; passo < d->qtdAtivos; passo++)
+    {
+        fora[atual] = 0;
+
+        int proximo = -1;
+        for (int i = 0; i < d->qtdIds; i++)
+        {
+            if (!fora[i])
+                continue;
+
+            double w = distDin(d, atual, i);
+            if (w < custo[i])
+                custo[i] = w;
+            if (proximo < 0 || custo[i] < custo[proximo])
+                proximo = i;
+        }
+
+        peso += custo[proximo];
+        atual = proximo;
+    }
+
+    free(custo);
+    free(fora);
+
+    return peso;
+}
+
+int getArestasMSTDinamico(tDinamico *d, int *pares)
+{
+    int qtd = 0;
+
+    for (int e = 0; e < d->qtdArestas; e++)
+    {
+        if (!d->emUso[e])
+            continue;
+        pares[2 * qtd] = d->eu[e];
+        pares[2 * qtd + 1] = d->ev[e];
+        qtd++;
+    }
+
+    return qtd;
+}
+
+double getTourDinamico(tDinamico *d, int *tour)
+{
+    int inicio = 0;
+    while (inicio < d->qtdIds && !d->ativo[inicio])
+        inicio++;
+
+    if (inicio == d->qtdIds)
+        return 0;
+
+    double comprimento = 0;
+    int v = inicio;
+    for (int i = 0; i < d->qtdAtivos; i++)
+    {
+        tour[i] = v;
+        comprimento += distDin(d, v, d->prox[v]);
+        v = d->prox[v];
+    }
+
+    return comprimento;
+}
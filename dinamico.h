@@ -0,0 +1,126 @@
+#ifndef DINAMICO_H
+#define DINAMICO_H
+
+#include "grafo.h"
+
+typedef struct stDinamico tDinamico;
+
+/**
+ * @brief Cria a estrutura dinâmica a partir de uma instância já resolvida
+ * @details Os vértices ganham os ids 0..Qtd_vértices-1, e cada vértice inserido depois recebe
+ * o próximo id livre (ids removidos não são reaproveitados). A MST fica em uma link-cut tree,
+ * que responde conectividade e "maior aresta no caminho" em O(log n) amortizado, e o tour em uma
+ * lista duplamente encadeada. Os vizinhos vêm de uma grade espacial incremental.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param tour Ordem de visita
+ * @return tDinamico*
+ */
+tDinamico *initDinamico(tGrafo *grafo, tAresta **MST, int *tour);
+
+/**
+ * @brief Destrói a estrutura dinâmica
+ *
+ * @param dinamico Estrutura a ser liberada
+ */
+void freeDinamico(tDinamico *dinamico);
+
+/**
+ * @brief Insere um vértice novo
+ * @details MST: as arestas até os vizinhos próximos entram uma a uma, e cada uma troca a maior
+ * aresta do ciclo que fecha, se for mais leve. Tour: inserção mais barata entre as arestas do
+ * tour que tocam os vizinhos, seguida de um 2-opt local.
+ *
+ * @param dinamico Estrutura dinâmica
+ * @param x Coordenada x
+ * @param y Coordenada y
+ * @return Id do vértice inserido
+ */
+int insereVerticeDinamico(tDinamico *dinamico, float x, float y);
+
+/**
+ * @brief Remove um vértice
+ * @details MST: as subárvores que ficam soltas são religadas com Kruskal sobre as arestas entre
+ * vértices próximos ao removido. Tour: liga antecessor e sucessor, seguido de um 2-opt local.
+ *
+ * @param dinamico Estrutura dinâmica
+ * @param id Id do vértice
+ * @return 1 se removeu, 0 se o id não existe
+ */
+int removeVerticeDinamico(tDinamico *dinamico, int id);
+
+/**
+ * @brief Move um vértice (remoção seguida de inserção, mantendo o id)
+ *
+ * @param dinamico Estrutura dinâmica
+ * @param id Id do vértice
+ * @param x Nova coordenada x
+ * @param y Nova coordenada y
+ * @return 1 se moveu, 0 se o id não existe
+ */
+int moveVerticeDinamico(tDinamico *dinamico, int id, float x, float y);
+
+/**
+ * @brief Pega a quantidade de vértices ativos
+ *
+ * @param dinamico Estrutura dinâmica
+ * @return int
+ */
+int getQtdAtivosDinamico(tDinamico *dinamico);
+
+/**
+ * @brief Pega o maior id já usado mais 1 (tamanho do espaço de ids)
+ *
+ * @param dinamico Estrutura dinâmica
+ * @return int
+ */
+int getQtdIdsDinamico(tDinamico *dinamico);
+
+/**
+ * @brief Diz se o id está ativo e, se estiver, pega as coordenadas
+ *
+ * @param dinamico Estrutura dinâmica
+ * @param id Id do vértice
+ * @param x Saída: coordenada x (pode ser NULL)
+ * @param y Saída: coordenada y (pode ser NULL)
+ * @return 1 se ativo, 0 se não
+ */
+int getVerticeDinamico(tDinamico *dinamico, int id, float *x, float *y);
+
+/**
+ * @brief Pega o peso atual da MST
+ *
+ * @param dinamico Estrutura dinâmica
+ * @return double
+ */
+double getPesoMSTDinamico(tDinamico *dinamico);
+
+/**
+ * @brief Recalcula do zero o peso da MST dos vértices ativos (Prim denso, O(n²))
+ * @details Só para conferir a MST mantida incrementalmente.
+ *
+ * @param dinamico Estrutura dinâmica
+ * @return double
+ */
+double pesoMSTExatoDinamico(tDinamico *dinamico);
+
+/**
+ * @brief Copia as arestas atuais da MST
+ *
+ * @param dinamico Estrutura dinâmica
+ * @param pares Vetor de saída com 2 * (ativos - 1) posições
+ * @return Quantidade de arestas
+ */
+int getArestasMSTDinamico(tDinamico *dinamico, int *pares);
+
+/**
+ * @brief Copia o tour atual, começando pelo vértice ativo de menor id
+ *
+ * @param dinamico Estrutura dinâmica
+ * @param tour Vetor de saída com getQtdAtivosDinamico posições
+ * @return Comprimento do tour
+ */
+double getTourDinamico(tDinamico *dinamico, int *tour);
+
+#endif
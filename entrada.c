@@ -0,0 +1,338 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "entrada.h"
+
+#define TAM_BLOCO_ENTRADA (1 << 20) // Bytes pedidos a cada read
+#define TAM_LOTE 4096               // Coordenadas por lote
+#define QTD_LOTES 8                 // Lotes em trânsito entre as threads
+
+typedef struct
+{
+    int qtd;
+    float x[TAM_LOTE], y[TAM_LOTE];
+} tLote;
+
+// Fila de lotes entre a produtora (leitura e conversão) e a consumidora (grade)
+typedef struct
+{
+    int fd;
+
+    // Cabeçalho: escrito pela produtora antes de publicar o primeiro lote
+    char nome[64];
+    char metrica[64];
+    int dimensao;
+
+    tLote *lotes;    // QTD_LOTES lotes reaproveitados em anel
+    int inicio, fim; // Lotes publicados e ainda não consumidos: [inicio, fim)
+    int terminou;
+    pthread_mutex_t trava;
+    pthread_cond_t temLote, temEspaco;
+
+    // Estado da conversão (só a produtora mexe)
+    int naSecao; // Já passou do cabeçalho
+    int acabou;  // Achou a linha EOF
+    tLote *atual;
+} tFluxo;
+
+// ------------------------------ Produtora ------------------------------ //
+
+static void publicaLote(tFluxo *f)
+{
+    pthread_mutex_lock(&f->trava);
+    f->fim++;
+    pthread_cond_signal(&f->temLote);
+    pthread_mutex_unlock(&f->trava);
+
+    f->atual = NULL;
+}
+
+static void adicionaPonto(tFluxo *f, float x, float y)
+{
+    if (!f->atual)
+    {
+        // Espera a consumidora liberar um lote do anel
+        pthread_mutex_lock(&f->trava);
+        while (f->fim - f->inicio == QTD_LOTES)
+            pthread_cond_wait(&f->temEspaco, &f->trava);
+        f->atual = &(f->lotes[f->fim % QTD_LOTES]);
+        pthread_mutex_unlock(&f->trava);
+
+        f->atual->qtd = 0;
+    }
+
+    f->atual->x[f->atual->qtd] = x;
+    f->atual->y[f->atual->qtd] = y;
+    if (++f->atual->qtd == TAM_LOTE)
+        publicaLote(f);
+}
+
+// Copia o valor de "CHAVE : valor" sem os espaços das pontas
+static void copiaValor(char *destino, int tam, const char *valor)
+{
+    while (isspace((unsigned char)*valor))
+        valor++;
+
+    int n = strlen(valor);
+    while (n > 0 && isspace((unsigned char)valor[n - 1]))
+        n--;
+    if (n > tam - 1)
+        n = tam - 1;
+
+    memcpy(destino, valor, n);
+    destino[n] = '\0';
+}
+
+static void processaLinha(tFluxo *f, char *linha)
+{
+    while (isspace((unsigned char)*linha))
+        linha++;
+    if (*linha == '\0')
+        return;
+
+    if (!f->naSecao)
+    {
+        // Linha começando por número: arquivo sem cabeçalho, só "id x y"
+        if (!isdigit((unsigned char)*linha) && *linha != '-' && *linha != '+' && *linha != '.')
+        {
+            if (!strncmp(linha, "NODE_COORD_SECTION", 18))
+            {
+                f->naSecao = 1;
+                return;
+            }
+
+            char *doisPontos = strchr(linha, ':');
+            if (!doisPontos)
+                return;
+
+            int tamChave = doisPontos - linha;
+            while (tamChave > 0 && isspace((unsigned char)linha[tamChave - 1]))
+                tamChave--;
+
+            if (tamChave == 4 && !strncmp(linha, "NAME", 4))
+                copiaValor(f->nome, sizeof(f->nome), doisPontos + 1);
+            else if (tamChave == 9 && !strncmp(linha, "DIMENSION", 9))
+                f->dimensao = atoi(doisPontos + 1);
+            else if (tamChave == 16 && !strncmp(linha, "EDGE_WEIGHT_TYPE", 16))
+                copiaValor(f->metrica, sizeof(f->metrica), doisPontos + 1);
+            return;
+        }
+        f->naSecao = 1;
+    }
+
+    if (!strncmp(linha, "EOF", 3))
+    {
+        f->acabou = 1;
+        return;
+    }
+
+    // Pula o id e lê x e y
+    char *p = linha;
+    while (*p && !isspace((unsigned char)*p))
+        p++;
+
+    char *fimX, *fimY;
+    float x = strtof(p, &fimX);
+    if (fimX == p)
+        return;
+    float y = strtof(fimX, &fimY);
+    if (fimY == fimX)
+        return;
+
+    adicionaPonto(f, x, y);
+}
+
+static void *produtora(void *arg)
+{
+    tFluxo *f = (tFluxo *)arg;
+
+    // Espaço para um bloco novo mais o pedaço de linha que sobrou do anterior
+    char *buffer = (char *)malloc(2 * TAM_BLOCO_ENTRADA + 1);
+    size_t usado = 0;
+
+    while (!f->acabou)
+    {
+        ssize_t lidos = read(f->fd, buffer + usado, TAM_BLOCO_ENTRADA);
+        int fimArquivo = lidos <= 0;
+        if (lidos > 0)
+            usado += lidos;
+
+        size_t p = 0;
+        while (!f->acabou)
+        {
+            char *quebra = (char *)memchr(buffer + p, '\n', usado - p);
+            if (!quebra)
+            {
+                // A última linha pode não ter '\n'
+                if (fimArquivo && p < usado)
+                {
+                    buffer[usado] = '\0';
+                    processaLinha(f, buffer + p);
+                    p = usado;
+                }
+                break;
+            }
+
+            *quebra = '\0';
+            processaLinha(f, buffer + p);
+            p = quebra - buffer + 1;
+        }
+
+        // Linha maior que um bloco inteiro não é coordenada: descarta
+        if (usado - p >= TAM_BLOCO_ENTRADA)
+            p = usado;
+
+        memmove(buffer, buffer + p, usado - p);
+        usado -= p;
+
+        if (fimArquivo)
+            break;
+    }
+
+    if (f->atual)
+        publicaLote(f);
+
+    pthread_mutex_lock(&f->trava);
+    f->terminou = 1;
+    pthread_cond_signal(&f->temLote);
+    pthread_mutex_unlock(&f->trava);
+
+    free(buffer);
+    return NULL;
+}
+
+// ----------------------------- Consumidora ----------------------------- //
+
+tGrafo *leEntradaFluxo(FILE *arq, char *nome, int tamNome, char *metrica, int tamMetrica, tGrade **grade)
+{
+    tFluxo f;
+    memset(&f, 0, sizeof(tFluxo));
+    f.fd = fileno(arq);
+    f.lotes = (tLote *)malloc(QTD_LOTES * sizeof(tLote));
+    pthread_mutex_init(&f.trava, NULL);
+    pthread_cond_init(&f.temLote, NULL);
+    pthread_cond_init(&f.temEspaco, NULL);
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, produtora, &f);
+
+    int n = 0, capacidade = 0;
+    float *xs = NULL, *ys = NULL;
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    float tamCelula = 1;
+    tGrade *g = NULL;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&f.trava);
+        while (f.inicio == f.fim && !f.terminou)
+            pthread_cond_wait(&f.temLote, &f.trava);
+        if (f.inicio == f.fim)
+        {
+            pthread_mutex_unlock(&f.trava);
+            break;
+        }
+        tLote *lote = &(f.lotes[f.inicio % QTD_LOTES]);
+        pthread_mutex_unlock(&f.trava);
+
+        if (!g)
+        {
+            // Lado da grade pelo espaçamento médio estimado no primeiro lote
+            float loteMinX = lote->x[0], loteMaxX = lote->x[0], loteMinY = lote->y[0], loteMaxY = lote->y[0];
+            for (int i = 1; i < lote->qtd; i++)
+            {
+                loteMinX = fminf(loteMinX, lote->x[i]);
+                loteMaxX = fmaxf(loteMaxX, lote->x[i]);
+                loteMinY = fminf(loteMinY, lote->y[i]);
+                loteMaxY = fmaxf(loteMaxY, lote->y[i]);
+            }
+            float area = (loteMaxX - loteMinX) * (loteMaxY - loteMinY);
+            int esperados = f.dimensao > lote->qtd ? f.dimensao : lote->qtd;
+
+            // Supõe que a amostra já cobre a área toda; sem DIMENSION, só conta com a amostra
+            if (area > 0)
+                tamCelula = sqrtf(area / esperados);
+            g = initGrade(tamCelula);
+
+            capacidade = esperados;
+            xs = (float *)malloc(capacidade * sizeof(float));
+            ys = (float *)malloc(capacidade * sizeof(float));
+            minX = maxX = lote->x[0];
+            minY = maxY = lote->y[0];
+        }
+
+        if (n + lote->qtd > capacidade)
+        {
+            while (n + lote->qtd > capacidade)
+                capacidade *= 2;
+            xs = (float *)realloc(xs, capacidade * sizeof(float));
+            ys = (float *)realloc(ys, capacidade * sizeof(float));
+        }
+
+        for (int i = 0; i < lote->qtd; i++, n++)
+        {
+            xs[n] = lote->x[i];
+            ys[n] = lote->y[i];
+            insereGrade(g, n, xs[n], ys[n]);
+
+            minX = fminf(minX, xs[n]);
+            maxX = fmaxf(maxX, xs[n]);
+            minY = fminf(minY, ys[n]);
+            maxY = fmaxf(maxY, ys[n]);
+        }
+
+        pthread_mutex_lock(&f.trava);
+        f.inicio++;
+        pthread_cond_signal(&f.temEspaco);
+        pthread_mutex_unlock(&f.trava);
+    }
+
+    pthread_join(thread, NULL);
+    pthread_mutex_destroy(&f.trava);
+    pthread_cond_destroy(&f.temLote);
+    pthread_cond_destroy(&f.temEspaco);
+    free(f.lotes);
+
+    snprintf(nome, tamNome, "%s", f.nome[0] ? f.nome : "stdin");
+    if (f.metrica[0])
+        snprintf(metrica, tamMetrica, "%s", f.metrica);
+
+    *grade = NULL;
+    if (n == 0)
+    {
+        free(xs);
+        free(ys);
+        return NULL;
+    }
+
+    // Estimativa ruim (ex.: entrada ordenada por coordenada): refaz a grade com o lado certo
+    float area = (maxX - minX) * (maxY - minY);
+    float ideal = area > 0 ? sqrtf(area / n) : 1;
+    if (tamCelula > 2 * ideal || tamCelula < ideal / 2)
+    {
+        freeGrade(g);
+        g = initGrade(ideal);
+        for (int i = 0; i < n; i++)
+            insereGrade(g, i, xs[i], ys[i]);
+    }
+
+    tGrafo *grafo = initGrafo();
+    tVertice *vertice = initVertice(0, 0);
+    setSizeVertices(grafo, n);
+    for (int i = 0; i < n; i++)
+    {
+        reinitVertice(vertice, xs[i], ys[i]);
+        setVertice(grafo, i, vertice);
+    }
+    freeVertice(vertice);
+
+    free(xs);
+    free(ys);
+
+    *grade = g;
+    return grafo;
+}
@@ -0,0 +1,27 @@
+#ifndef ENTRADA_H
+#define ENTRADA_H
+
+#include <stdio.h>
+#include "grafo.h"
+#include "grade.h"
+
+/**
+ * @brief Lê uma instância em fluxo (stdin ou pipe), com a leitura em paralelo à indexação
+ * @details Aceita TSPLIB (cabeçalho "CHAVE: valor" até NODE_COORD_SECTION) ou só linhas
+ * "id x y". Uma thread produtora lê blocos grandes com fread e converte as linhas em lotes de
+ * coordenadas; a thread que chamou consome os lotes e vai inserindo os pontos na grade
+ * espacial enquanto o resto ainda chega. O lado da grade é estimado no primeiro lote (com o
+ * DIMENSION, se houver); se no fim ele ficou longe do espaçamento médio real, a grade é
+ * refeita. Os ids do arquivo são ignorados: os vértices ficam na ordem de chegada.
+ *
+ * @param arq Arquivo já aberto (ex.: stdin)
+ * @param nome Saída: NAME do cabeçalho, ou "stdin" se não houver
+ * @param tamNome Tamanho do vetor nome
+ * @param metrica Saída: EDGE_WEIGHT_TYPE do cabeçalho (inalterada se não houver)
+ * @param tamMetrica Tamanho do vetor metrica
+ * @param grade Saída: grade com todos os vértices (ids == índices no grafo), liberar com freeGrade
+ * @return tGrafo* com os vértices lidos, ou NULL se nenhum vértice foi lido
+ */
+tGrafo *leEntradaFluxo(FILE *arq, char *nome, int tamNome, char *metrica, int tamMetrica, tGrade **grade);
+
+#endif
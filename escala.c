@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "escala.h"
+#include "tempo.h"
+#include "gerador.h"
+#include "contador.h"
+#include "hilbert.h"
+#include "grafo.h"
+#include "particao.h"
+#include "tour.h"
+#include "vizinhos.h"
+
+#define MAX_TAMANHOS 32
+#define QTD_FASES 9
+
+static const char *fases[QTD_FASES] = {"initAllArestas", "sortArestas", "kruskalAlgorithm", "caminhamentoMST",
+                                       "kruskalEsparso", "caminhamentoPreOrdem", "initVizinhos", "doisOpt",
+                                       "ordemHilbert"};
+
+// Nomes curtos para as colunas da tabela
+static const char *colunas[QTD_FASES] = {"arestas", "sort", "kruskal", "caminhaMST",
+                                         "kruskalEsp", "preOrdem", "vizinhos", "2-opt", "hilbert"};
+
+typedef struct
+{
+    double tempo[QTD_FASES]; // Segundos, -1 se a fase não rodou
+    double memoria[QTD_FASES]; // KB
+    double falhas[QTD_FASES];  // Falhas de cache, -1 sem contador
+} tMedida;
+
+// RSS atual em KB
+static double memoriaResidente()
+{
+    long paginas = 0;
+    FILE *arq = fopen("/proc/self/statm", "r");
+
+    if (arq)
+    {
+        if (fscanf(arq, "%*s %ld", &paginas) != 1)
+            paginas = 0;
+        fclose(arq);
+    }
+
+    return paginas * (sysconf(_SC_PAGESIZE) / 1024.0);
+}
+
+// Marca o início de uma fase; fimFase guarda o tempo, o quanto o RSS cresceu e as falhas de cache
+static double inicioTempo, inicioMemoria;
+static tContador *contador = NULL;
+
+static void inicioFase()
+{
+    inicioMemoria = memoriaResidente();
+    if (contador)
+        iniciaContador(contador);
+    inicioTempo = agora();
+}
+
+static void fimFase(tMedida *medida, int fase)
+{
+    medida->tempo[fase] = agora() - inicioTempo;
+    medida->falhas[fase] = contador ? leContador(contador) : -1;
+    double m = memoriaResidente() - inicioMemoria;
+    medida->memoria[fase] = m > 0 ? m : 0;
+}
+
+// Gera a instância e, se pedido, renumera pela curva de Hilbert (medindo a fase na medida != NULL)
+static tGrafo *preparaInstancia(int distribuicao, int n, unsigned long long semente, int hilbert, tMedida *medida)
+{
+    tGrafo *grafo = geraInstancia(distribuicao, n, semente);
+
+    if (hilbert)
+    {
+        if (medida)
+            inicioFase();
+        int *ordem = ordemHilbert(grafo);
+        renumeraGrafo(grafo, ordem);
+        free(ordem);
+        if (medida)
+            fimFase(medida, 8);
+    }
+
+    return grafo;
+}
+
+static void medeTamanho(int distribuicao, int n, unsigned long long semente, int limiteDenso, int hilbert,
+                        tMedida *medida)
+{
+    for (int f = 0; f < QTD_FASES; f++)
+        medida->tempo[f] = medida->memoria[f] = medida->falhas[f] = -1;
+
+    int *tour = (int *)malloc(n * sizeof(int));
+
+    if (n <= limiteDenso)
+    {
+        tGrafo *grafo = preparaInstancia(distribuicao, n, semente, hilbert, NULL);
+
+        inicioFase();
+        initAllArestas(grafo);
+        fimFase(medida, 0);
+
+        inicioFase();
+        sortArestas(grafo);
+        fimFase(medida, 1);
+
+        inicioFase();
+        tAresta **MST = kruskalAlgorithm(grafo);
+        fimFase(medida, 2);
+
+        inicioFase();
+        caminhamentoMST(MST, n, tour);
+        fimFase(medida, 3);
+
+        freeMST(MST);
+        freeGrafo(grafo);
+    }
+
+    // As fases esparsas num grafo novo (a mesma instância), sem o vetor de arestas
+    tGrafo *grafo = preparaInstancia(distribuicao, n, semente, hilbert, medida);
+
+    inicioFase();
+    tAresta **MST = kruskalEsparso(grafo);
+    fimFase(medida, 4);
+
+    inicioFase();
+    caminhamentoPreOrdem(MST, n, 0, tour);
+    fimFase(medida, 5);
+
+    inicioFase();
+    tVizinhos *vizinhos = initVizinhos(grafo, 10);
+    fimFase(medida, 6);
+
+    tTour *t = initTour(n);
+    setCidadesTour(t, tour);
+    inicioFase();
+    doisOpt(grafo, vizinhos, t);
+    fimFase(medida, 7);
+
+    freeTour(t);
+    freeVizinhos(vizinhos);
+    freeMST(MST);
+    freeGrafo(grafo);
+    free(tour);
+}
+
+/**
+ * @brief Ajusta y = a x^b por mínimos quadrados em log-log
+ * @details Pontos com y abaixo de minimo (ruído de medida) ficam de fora.
+ * @return int 1 se o ajuste foi feito, 0 se não há pelo menos 2 tamanhos diferentes
+ */
+static int ajustaPotencia(double *x, double *y, int qtd, double minimo, double *a, double *b)
+{
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    int usados = 0;
+
+    for (int i = 0; i < qtd; i++)
+    {
+        if (y[i] < minimo)
+            continue;
+        double lx = log(x[i]), ly = log(y[i]);
+        sx += lx;
+        sy += ly;
+        sxx += lx * lx;
+        sxy += lx * ly;
+        usados++;
+    }
+
+    if (usados < 2 || usados * sxx - sx * sx <= 0)
+        return 0;
+
+    *b = (usados * sxy - sx * sy) / (usados * sxx - sx * sx);
+    *a = exp((sy - *b * sx) / usados);
+
+    return 1;
+}
+
+void executaEscala(int distribuicao, int nMax, unsigned long long semente, int limiteDenso, int hilbert,
+                   const char *caminhoCSV)
+{
+#ifdef __GLIBC__
+    // Limiar fixo: blocos grandes sempre em mmap, para o RSS voltar ao liberar
+    mallopt(M_MMAP_THRESHOLD, 128 * 1024);
+#endif
+
+    int tamanhos[MAX_TAMANHOS];
+    int qtd = 0;
+    static const int passos[3] = {1, 2, 5};
+
+    for (long long base = 1000; qtd < MAX_TAMANHOS; base *= 10)
+    {
+        for (int p = 0; p < 3 && qtd < MAX_TAMANHOS && base * passos[p] <= nMax; p++)
+            tamanhos[qtd++] = (int)(base * passos[p]);
+        if (base * 10 > nMax)
+            break;
+    }
+
+    contador = initContador();
+
+    tMedida *medidas = (tMedida *)malloc((qtd > 0 ? qtd : 1) * sizeof(tMedida));
+    FILE *csv = caminhoCSV ? fopen(caminhoCSV, "w") : NULL;
+    if (csv)
+        fprintf(csv, "distribuicao,hilbert,n,fase,segundos,kb,falhas_cache\n");
+
+    printf("Distribuição %s, semente %llu, fases densas até n = %d%s\n", nomeDistribuicao(distribuicao), semente,
+           limiteDenso, hilbert ? ", vértices na ordem de Hilbert" : "");
+    printf("%9s", "n");
+    for (int f = 0; f < QTD_FASES; f++)
+        printf(" %12s", colunas[f]);
+    printf("   (segundos)\n");
+
+    for (int k = 0; k < qtd; k++)
+    {
+        medeTamanho(distribuicao, tamanhos[k], semente, limiteDenso, hilbert, &medidas[k]);
+
+        printf("%9d", tamanhos[k]);
+        for (int f = 0; f < QTD_FASES; f++)
+        {
+            if (medidas[k].tempo[f] < 0)
+                printf(" %12s", "-");
+            else
+                printf(" %12.4f", medidas[k].tempo[f]);
+
+            if (csv && medidas[k].tempo[f] >= 0)
+                fprintf(csv, "%s,%d,%d,%s,%.6f,%.0f,%.0f\n", nomeDistribuicao(distribuicao), hilbert, tamanhos[k],
+                        fases[f], medidas[k].tempo[f], medidas[k].memoria[f], medidas[k].falhas[f]);
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+
+    // Falhas de cache por fase, em milhões
+    if (contador)
+    {
+        printf("\n%9s", "n");
+        for (int f = 0; f < QTD_FASES; f++)
+            printf(" %12s", colunas[f]);
+        printf("   (milhões de falhas de cache)\n");
+
+        for (int k = 0; k < qtd; k++)
+        {
+            printf("%9d", tamanhos[k]);
+            for (int f = 0; f < QTD_FASES; f++)
+            {
+                if (medidas[k].falhas[f] < 0)
+                    printf(" %12s", "-");
+                else
+                    printf(" %12.3f", medidas[k].falhas[f] / 1e6);
+            }
+            printf("\n");
+        }
+    }
+    else
+        printf("\nContador de falhas de cache indisponível (perf_event_open)\n");
+
+    // Ajustes por fase
+    double *x = (double *)malloc((qtd > 0 ? qtd : 1) * sizeof(double));
+    double *y = (double *)malloc((qtd > 0 ? qtd : 1) * sizeof(double));
+
+    printf("\n%-22s %10s %12s %10s %12s\n", "fase", "tempo ~ n^", "em nMax", "mem ~ n^", "em nMax");
+    for (int f = 0; f < QTD_FASES; f++)
+    {
+        int m = 0;
+        for (int k = 0; k < qtd; k++)
+        {
+            if (medidas[k].tempo[f] < 0)
+                continue;
+            x[m] = tamanhos[k];
+            y[m] = medidas[k].tempo[f];
+            m++;
+        }
+
+        double a = 0, b = 0;
+        printf("%-22s", fases[f]);
+        if (ajustaPotencia(x, y, m, 1e-4, &a, &b))
+            printf(" %10.2f %11.2fs", b, a * pow(nMax, b));
+        else
+            printf(" %10s %12s", "-", "-");
+
+        m = 0;
+        for (int k = 0; k < qtd; k++)
+        {
+            if (medidas[k].tempo[f] < 0)
+                continue;
+            y[m++] = medidas[k].memoria[f];
+        }
+        if (ajustaPotencia(x, y, m, 64, &a, &b))
+            printf(" %10.2f %10.0fMB", b, a * pow(nMax, b) / 1024);
+        else
+            printf(" %10s %12s", "-", "-");
+        printf("\n");
+    }
+
+    free(x);
+    free(y);
+    free(medidas);
+    if (csv)
+        fclose(csv);
+    if (contador)
+        freeContador(contador);
+    contador = NULL;
+}
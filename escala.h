@@ -0,0 +1,24 @@
+#ifndef ESCALA_H
+#define ESCALA_H
+
+/**
+ * @brief Mede o tempo e a memória de cada fase do pipeline em instâncias sintéticas crescentes
+ * @details Tamanhos na sequência 1-2-5 de 1000 até nMax. As fases densas (initAllArestas,
+ * sortArestas, kruskalAlgorithm, caminhamentoMST) só rodam até limiteDenso vértices, porque o
+ * vetor de arestas é O(n²); as esparsas (kruskalEsparso, caminhamentoPreOrdem, initVizinhos,
+ * doisOpt) rodam em todos os tamanhos. Para cada fase ajusta tempo = a n^b e memória = a n^b
+ * por mínimos quadrados em log-log e mostra a previsão para nMax.
+ * Memória é o quanto o RSS cresceu durante a fase (o que a fase alocou e manteve). Com
+ * contador de hardware disponível (ver contador.h) também mostra as falhas de cache por fase.
+ *
+ * @param distribuicao DIST_* (ver gerador.h)
+ * @param nMax Maior tamanho
+ * @param semente Semente das instâncias
+ * @param limiteDenso Maior tamanho para as fases densas
+ * @param hilbert Se não for 0, renumera os vértices pela curva de Hilbert antes das fases
+ * @param caminhoCSV Arquivo com as medidas brutas (n, fase, segundos, KB), ou NULL
+ */
+void executaEscala(int distribuicao, int nMax, unsigned long long semente, int limiteDenso, int hilbert,
+                   const char *caminhoCSV);
+
+#endif
@@ -0,0 +1,769 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "genetico.h"
+#include "tempo.h"
+#include "tour.h"
+#include "aleatorio.h"
+
+#define FILHOS_POR_PAR 30       // AB-ciclos avaliados (um filho cada) por par de pais
+#define GERACOES_SEM_MELHORA 5  // Gerações seguidas sem nenhum filho melhor: população convergiu
+#define CAPACIDADE_FILA 4       // Migrantes em trânsito por fila
+#define INTERVALO_RELATORIO 0.1 // Segundos entre consultas do melhor global
+#define PERTURBACOES_INICIAIS 10 // Um double-bridge a cada tantas cidades nos indivíduos iniciais
+
+// Pool de memória da ilha: um bloco só, reservado em pedaços alinhados
+typedef struct
+{
+    char *base;
+    size_t usado, tam;
+} tPool;
+
+// Fila de migração sem travas: um produtor (ilha i) e um consumidor (ilha i + 1)
+typedef struct
+{
+    _Atomic int inicio; // Próximo slot a ler, só o consumidor altera
+    _Atomic int fim;    // Próximo slot a escrever, só o produtor altera
+    int *tours;         // CAPACIDADE_FILA tours de n cidades
+} tFila;
+
+typedef struct stIlha tIlha;
+
+struct stIlha
+{
+    int id;
+
+    tGrafo *grafo;
+    tAresta **MST;
+    tVizinhos *vizinhos;
+    int *tourInicial;
+
+    int n;
+    int populacao;
+    int intervaloMigracao;
+    double segundos;
+    double otimo;
+    double inicio;
+    unsigned long long semente;
+
+    tFila *entrada;
+    tFila *saida;
+
+    // Melhor chave global: (bits do comprimento << 32) | ilha
+    _Atomic unsigned long long *melhorGlobal;
+    _Atomic int *parar;
+    _Atomic int *ativas;
+
+    // Tudo abaixo mora no pool da ilha
+    tPool pool;
+    tAleatorio *aleatorio;
+
+    // Indivíduo: link[2c] e link[2c + 1] são os dois vizinhos da cidade c
+    int **links;
+    double *comprimentos;
+    int *permutacao;
+
+    // Espaço do EAX
+    int *filho, *melhorFilho;
+    int *remA, *remB;    // Arestas de A e de B ainda não usadas em AB-ciclos
+    int *caminho;        // Passeio alternado A, B, A, ...
+    int *posA, *posB;    // Posição no passeio de onde o vértice sai por aresta de A (ou B)
+    int *ciclos;         // Vértices dos AB-ciclos (o primeiro se repete no fim)
+    int *inicioCiclo;
+    int *tipoCiclo;      // 0 se a primeira aresta do ciclo é de A
+    int *escolha;
+    int *subciclo, *proximoMembro, *cabeca, *cauda, *tamSubciclo;
+    int *ordem;
+
+    int *melhorTour;
+    double melhorComprimento;
+    int geracoes;
+    int reinicios;
+};
+
+static void *reservaPool(tPool *pool, size_t tam)
+{
+    size_t inicio = (pool->usado + 63) & ~(size_t)63;
+
+    if (inicio + tam > pool->tam)
+    {
+        printf("Pool da ilha esgotado\n");
+        exit(1);
+    }
+    pool->usado = inicio + tam;
+
+    return pool->base + inicio;
+}
+
+static int *reservaInts(tPool *pool, long long qtd)
+{
+    return (int *)reservaPool(pool, (size_t)qtd * sizeof(int));
+}
+
+// ------------------------- Representação ------------------------- //
+
+static void linksDeTour(const int *tour, int n, int *link)
+{
+    for (int i = 0; i < n; i++)
+    {
+        int c = tour[i];
+        link[2 * c] = tour[i == 0 ? n - 1 : i - 1];
+        link[2 * c + 1] = tour[i == n - 1 ? 0 : i + 1];
+    }
+}
+
+static void tourDeLinks(const int *link, int n, int *tour)
+{
+    int anterior = 0, atual = link[0];
+
+    tour[0] = 0;
+    for (int i = 1; i < n; i++)
+    {
+        tour[i] = atual;
+        int proximo = link[2 * atual] != anterior ? link[2 * atual] : link[2 * atual + 1];
+        anterior = atual;
+        atual = proximo;
+    }
+}
+
+// Troca, na lista de vizinhos de a, o vizinho velho pelo novo (-1 é "posição vazia")
+static void troca(int *link, int a, int velho, int novo)
+{
+    if (link[2 * a] == velho)
+        link[2 * a] = novo;
+    else
+        link[2 * a + 1] = novo;
+}
+
+static double dist(tIlha *ilha, int a, int b)
+{
+    return distVertices(ilha->grafo, a, b);
+}
+
+static void embaralha(tAleatorio *aleatorio, int *vetor, int tam)
+{
+    for (int i = tam - 1; i > 0; i--)
+    {
+        int j = aleatorioIntervalo(aleatorio, i + 1);
+        int aux = vetor[i];
+        vetor[i] = vetor[j];
+        vetor[j] = aux;
+    }
+}
+
+// ------------------------------ EAX ------------------------------ //
+
+/**
+ * @brief Decompõe as arestas de A e B que não são comuns em AB-ciclos
+ * @details Passeio aleatório alternando arestas de A e de B; sempre que o passeio volta a um
+ * vértice de onde saiu pelo tipo oposto ao da chegada, o trecho fecha um ciclo alternado e é
+ * retirado do passeio.
+ * @return int Quantidade de AB-ciclos
+ */
+static int geraABCiclos(tIlha *ilha, const int *A, const int *B)
+{
+    int n = ilha->n;
+    int *remA = ilha->remA, *remB = ilha->remB;
+
+    memcpy(remA, A, 2 * n * sizeof(int));
+    memcpy(remB, B, 2 * n * sizeof(int));
+
+    // Arestas comuns ficam de fora
+    for (int c = 0; c < n; c++)
+    {
+        for (int s = 0; s < 2; s++)
+        {
+            int a = A[2 * c + s];
+            if (a == B[2 * c] || a == B[2 * c + 1])
+            {
+                remA[2 * c + s] = -1;
+                troca(remB, c, a, -1);
+            }
+        }
+    }
+
+    int qtdCiclos = 0, total = 0;
+    ilha->inicioCiclo[0] = 0;
+
+    for (int i = 0; i < n; i++)
+        ilha->ordem[i] = i;
+    embaralha(ilha->aleatorio, ilha->ordem, n);
+
+    for (int k = 0; k < n; k++)
+    {
+        int v0 = ilha->ordem[k];
+        if (remA[2 * v0] < 0 && remA[2 * v0 + 1] < 0)
+            continue;
+
+        int tam = 1;
+        ilha->caminho[0] = v0;
+        ilha->posA[v0] = 0;
+
+        while (tam > 1 || remA[2 * v0] >= 0 || remA[2 * v0 + 1] >= 0)
+        {
+            int x = ilha->caminho[tam - 1];
+            int tipo = (tam - 1) % 2; // 0: sai por A, 1: sai por B
+            int *rem = tipo == 0 ? remA : remB;
+
+            int y;
+            if (rem[2 * x] >= 0 && rem[2 * x + 1] >= 0)
+                y = rem[2 * x + aleatorioIntervalo(ilha->aleatorio, 2)];
+            else
+                y = rem[2 * x] >= 0 ? rem[2 * x] : rem[2 * x + 1];
+
+            troca(rem, x, y, -1);
+            troca(rem, y, x, -1);
+
+            // Chegou em y por "tipo": fecha ciclo se y já saiu antes pelo outro tipo
+            int *pos = tipo == 0 ? ilha->posB : ilha->posA;
+            if (pos[y] >= 0)
+            {
+                int i = pos[y];
+
+                ilha->tipoCiclo[qtdCiclos] = i % 2;
+                for (int j = i; j < tam; j++)
+                    ilha->ciclos[total++] = ilha->caminho[j];
+                ilha->ciclos[total++] = y;
+                ilha->inicioCiclo[++qtdCiclos] = total;
+
+                for (int j = tam - 1; j > i; j--)
+                {
+                    if (j % 2 == 0)
+                        ilha->posA[ilha->caminho[j]] = -1;
+                    else
+                        ilha->posB[ilha->caminho[j]] = -1;
+                }
+                tam = i + 1;
+            }
+            else
+            {
+                if (tam % 2 == 0)
+                    ilha->posA[y] = tam;
+                else
+                    ilha->posB[y] = tam;
+                ilha->caminho[tam++] = y;
+            }
+        }
+
+        ilha->posA[v0] = -1;
+    }
+
+    return qtdCiclos;
+}
+
+// Troca, no filho, as arestas de A do ciclo c pelas de B; devolve a variação do comprimento
+static double aplicaCiclo(tIlha *ilha, int *filho, int c)
+{
+    int *v = &(ilha->ciclos[ilha->inicioCiclo[c]]);
+    int arestas = ilha->inicioCiclo[c + 1] - ilha->inicioCiclo[c] - 1;
+    double delta = 0;
+
+    for (int j = (ilha->tipoCiclo[c] == 0 ? 0 : 1); j < arestas; j += 2)
+    {
+        troca(filho, v[j], v[j + 1], -1);
+        troca(filho, v[j + 1], v[j], -1);
+        delta -= dist(ilha, v[j], v[j + 1]);
+    }
+    for (int j = (ilha->tipoCiclo[c] == 0 ? 1 : 0); j < arestas; j += 2)
+    {
+        troca(filho, v[j], -1, v[j + 1]);
+        troca(filho, v[j + 1], -1, v[j]);
+        delta += dist(ilha, v[j], v[j + 1]);
+    }
+
+    return delta;
+}
+
+// Separa a solução intermediária em subciclos; devolve quantos são
+static int rotulaSubciclos(tIlha *ilha, const int *filho)
+{
+    int n = ilha->n, m = 0;
+
+    for (int c = 0; c < n; c++)
+        ilha->subciclo[c] = -1;
+
+    for (int s = 0; s < n; s++)
+    {
+        if (ilha->subciclo[s] >= 0)
+            continue;
+
+        int anterior = -1, atual = s, ultimo = -1, tam = 0;
+        ilha->cabeca[m] = s;
+        do
+        {
+            ilha->subciclo[atual] = m;
+            if (ultimo >= 0)
+                ilha->proximoMembro[ultimo] = atual;
+            ultimo = atual;
+            tam++;
+
+            int proximo = filho[2 * atual] != anterior ? filho[2 * atual] : filho[2 * atual + 1];
+            anterior = atual;
+            atual = proximo;
+        } while (atual != s);
+
+        ilha->proximoMembro[ultimo] = -1;
+        ilha->cauda[m] = ultimo;
+        ilha->tamSubciclo[m] = tam;
+        m++;
+    }
+
+    return m;
+}
+
+// Avalia a troca de (u, u2) e (v, v2) por (u, v) e (u2, v2), e por (u, v2) e (u2, v)
+static void avaliaJuncao(tIlha *ilha, int u, int u2, int v, int v2, double *melhor, int *escolhida)
+{
+    double base = dist(ilha, u, u2) + dist(ilha, v, v2);
+    double d1 = dist(ilha, u, v) + dist(ilha, u2, v2) - base;
+    double d2 = dist(ilha, u, v2) + dist(ilha, u2, v) - base;
+
+    if (d1 < *melhor)
+    {
+        *melhor = d1;
+        escolhida[0] = u, escolhida[1] = u2, escolhida[2] = v, escolhida[3] = v2;
+    }
+    if (d2 < *melhor)
+    {
+        *melhor = d2;
+        escolhida[0] = u, escolhida[1] = u2, escolhida[2] = v2, escolhida[3] = v;
+    }
+}
+
+/**
+ * @brief Junta os subciclos em um tour, sempre o menor com algum vizinho, pela troca 2-opt mais barata
+ * @details As trocas procuradas ligam um vértice do menor subciclo a um dos seus candidatos
+ * fora dele; sem candidato fora, tenta todos os vértices a partir do primeiro membro.
+ * @return double Variação do comprimento
+ */
+static double reuneSubciclos(tIlha *ilha, int *filho, int m)
+{
+    int k = getQtdVizinhos(ilha->vizinhos);
+    double delta = 0;
+
+    for (int restantes = m; restantes > 1; restantes--)
+    {
+        int U = -1;
+        for (int s = 0; s < m; s++)
+            if (ilha->tamSubciclo[s] > 0 && (U < 0 || ilha->tamSubciclo[s] < ilha->tamSubciclo[U]))
+                U = s;
+
+        double melhor = HUGE_VAL;
+        int e[4] = {-1, -1, -1, -1};
+
+        for (int u = ilha->cabeca[U]; u >= 0; u = ilha->proximoMembro[u])
+        {
+            int *lista = getVizinhos(ilha->vizinhos, u);
+            for (int su = 0; su < 2; su++)
+                for (int j = 0; j < k; j++)
+                    if (ilha->subciclo[lista[j]] != U)
+                        for (int sv = 0; sv < 2; sv++)
+                            avaliaJuncao(ilha, u, filho[2 * u + su], lista[j], filho[2 * lista[j] + sv], &melhor, e);
+        }
+
+        if (e[0] < 0)
+        {
+            int u = ilha->cabeca[U];
+            for (int v = 0; v < ilha->n; v++)
+                if (ilha->subciclo[v] != U)
+                    for (int su = 0; su < 2; su++)
+                        for (int sv = 0; sv < 2; sv++)
+                            avaliaJuncao(ilha, u, filho[2 * u + su], v, filho[2 * v + sv], &melhor, e);
+        }
+
+        troca(filho, e[0], e[1], e[2]);
+        troca(filho, e[1], e[0], e[3]);
+        troca(filho, e[2], e[3], e[0]);
+        troca(filho, e[3], e[2], e[1]);
+        delta += melhor;
+
+        // Os membros de U passam para o subciclo de destino
+        int V = ilha->subciclo[e[2]];
+        for (int u = ilha->cabeca[U]; u >= 0; u = ilha->proximoMembro[u])
+            ilha->subciclo[u] = V;
+        ilha->proximoMembro[ilha->cauda[V]] = ilha->cabeca[U];
+        ilha->cauda[V] = ilha->cauda[U];
+        ilha->tamSubciclo[V] += ilha->tamSubciclo[U];
+        ilha->tamSubciclo[U] = 0;
+    }
+
+    return delta;
+}
+
+static double geraFilho(tIlha *ilha, const int *A, int *filho, int c)
+{
+    memcpy(filho, A, 2 * ilha->n * sizeof(int));
+
+    double delta = aplicaCiclo(ilha, filho, c);
+    int m = rotulaSubciclos(ilha, filho);
+
+    return delta + reuneSubciclos(ilha, filho, m);
+}
+
+// EAX-1AB: um filho por AB-ciclo (até FILHOS_POR_PAR); o melhor substitui A se for mais curto
+static int cruzamento(tIlha *ilha, int a, int b)
+{
+    int *A = ilha->links[a];
+    int qtd = geraABCiclos(ilha, A, ilha->links[b]);
+
+    if (qtd == 0)
+        return 0;
+
+    for (int c = 0; c < qtd; c++)
+        ilha->escolha[c] = c;
+    embaralha(ilha->aleatorio, ilha->escolha, qtd);
+
+    double melhorDelta = -1e-7;
+    int achou = 0;
+
+    for (int t = 0; t < qtd && t < FILHOS_POR_PAR; t++)
+    {
+        double delta = geraFilho(ilha, A, ilha->filho, ilha->escolha[t]);
+
+        if (delta < melhorDelta)
+        {
+            melhorDelta = delta;
+            achou = 1;
+
+            int *aux = ilha->melhorFilho;
+            ilha->melhorFilho = ilha->filho;
+            ilha->filho = aux;
+        }
+    }
+
+    if (!achou)
+        return 0;
+
+    memcpy(A, ilha->melhorFilho, 2 * ilha->n * sizeof(int));
+    ilha->comprimentos[a] += melhorDelta;
+
+    return 1;
+}
+
+// --------------------------- Migração --------------------------- //
+
+static void enviaMigrante(tFila *fila, const int *tour, int n)
+{
+    int fim = atomic_load_explicit(&fila->fim, memory_order_relaxed);
+    int inicio = atomic_load_explicit(&fila->inicio, memory_order_acquire);
+
+    // Fila cheia: o migrante é descartado
+    if (fim - inicio >= CAPACIDADE_FILA)
+        return;
+
+    memcpy(&(fila->tours[(size_t)(fim % CAPACIDADE_FILA) * n]), tour, n * sizeof(int));
+    atomic_store_explicit(&fila->fim, fim + 1, memory_order_release);
+}
+
+static void recebeMigrantes(tIlha *ilha)
+{
+    tFila *fila = ilha->entrada;
+    int n = ilha->n;
+
+    while (1)
+    {
+        int inicio = atomic_load_explicit(&fila->inicio, memory_order_relaxed);
+        int fim = atomic_load_explicit(&fila->fim, memory_order_acquire);
+        if (inicio == fim)
+            break;
+
+        memcpy(ilha->ordem, &(fila->tours[(size_t)(inicio % CAPACIDADE_FILA) * n]), n * sizeof(int));
+        atomic_store_explicit(&fila->inicio, inicio + 1, memory_order_release);
+
+        double comprimento = comprimentoTour(ilha->grafo, ilha->ordem, n);
+        int pior = 0, repetido = 0;
+        for (int i = 0; i < ilha->populacao; i++)
+        {
+            if (ilha->comprimentos[i] > ilha->comprimentos[pior])
+                pior = i;
+            if (fabs(ilha->comprimentos[i] - comprimento) < 1e-7)
+                repetido = 1;
+        }
+
+        if (!repetido && comprimento < ilha->comprimentos[pior])
+        {
+            linksDeTour(ilha->ordem, n, ilha->links[pior]);
+            ilha->comprimentos[pior] = comprimento;
+        }
+    }
+}
+
+// ----------------------------- Ilha ----------------------------- //
+
+static int atualizaMelhor(tIlha *ilha)
+{
+    int melhor = 0;
+    for (int i = 1; i < ilha->populacao; i++)
+        if (ilha->comprimentos[i] < ilha->comprimentos[melhor])
+            melhor = i;
+
+    if (ilha->comprimentos[melhor] >= ilha->melhorComprimento - 1e-7)
+        return 0;
+
+    // Recalcula do zero para não acumular erro de arredondamento dos deltas
+    tourDeLinks(ilha->links[melhor], ilha->n, ilha->melhorTour);
+    ilha->melhorComprimento = ilha->comprimentos[melhor] = comprimentoTour(ilha->grafo, ilha->melhorTour, ilha->n);
+
+    unsigned long long chave = chaveComprimento(ilha->melhorComprimento, ilha->id);
+    unsigned long long global = atomic_load(ilha->melhorGlobal);
+    while (chave < global && !atomic_compare_exchange_weak(ilha->melhorGlobal, &global, chave))
+        ;
+
+    if (ilha->otimo > 0 && ilha->melhorComprimento <= ilha->otimo * (1 + 1e-9))
+        atomic_store(ilha->parar, 1);
+
+    return 1;
+}
+
+static void geraPopulacao(tIlha *ilha, int *primeiro);
+
+static void inicializaIlha(tIlha *ilha)
+{
+    int n = ilha->n, P = ilha->populacao;
+    tPool *pool = &(ilha->pool);
+
+    // O próprio thread aloca e toca o pool: as páginas ficam perto dele
+    // Inteiros de todos os vetores abaixo, mais até 64 bytes de alinhamento por reserva
+    pool->tam = (size_t)sizeof(int) * ((2LL * P + 26) * n + P + 16) + (size_t)P * (sizeof(int *) + sizeof(double)) +
+                (size_t)64 * (P + 32);
+    pool->usado = 0;
+    pool->base = (char *)malloc(pool->tam);
+
+    ilha->links = (int **)reservaPool(pool, P * sizeof(int *));
+    for (int i = 0; i < P; i++)
+        ilha->links[i] = reservaInts(pool, 2LL * n);
+    ilha->comprimentos = (double *)reservaPool(pool, P * sizeof(double));
+    ilha->permutacao = reservaInts(pool, P);
+
+    ilha->filho = reservaInts(pool, 2LL * n);
+    ilha->melhorFilho = reservaInts(pool, 2LL * n);
+    ilha->remA = reservaInts(pool, 2LL * n);
+    ilha->remB = reservaInts(pool, 2LL * n);
+    ilha->caminho = reservaInts(pool, 2LL * n + 2);
+    ilha->posA = reservaInts(pool, n);
+    ilha->posB = reservaInts(pool, n);
+    ilha->ciclos = reservaInts(pool, 3LL * n + 2);
+    ilha->inicioCiclo = reservaInts(pool, n + 1);
+    ilha->tipoCiclo = reservaInts(pool, n);
+    ilha->escolha = reservaInts(pool, n);
+    ilha->subciclo = reservaInts(pool, n);
+    ilha->proximoMembro = reservaInts(pool, n);
+    ilha->cabeca = reservaInts(pool, n);
+    ilha->cauda = reservaInts(pool, n);
+    ilha->tamSubciclo = reservaInts(pool, n);
+    ilha->ordem = reservaInts(pool, n);
+    ilha->melhorTour = reservaInts(pool, n);
+
+    for (int c = 0; c < n; c++)
+        ilha->posA[c] = ilha->posB[c] = -1;
+
+    ilha->aleatorio = initAleatorio(sementeDerivada(ilha->semente, ilha->id));
+    ilha->melhorComprimento = HUGE_VAL;
+    ilha->geracoes = 0;
+    ilha->reinicios = 0;
+
+    geraPopulacao(ilha, ilha->id == 0 ? ilha->tourInicial : NULL);
+}
+
+/**
+ * @brief Gera a população: pré-ordens da MST a partir de raízes sorteadas, perturbadas e com 2-opt
+ * @details Se primeiro != NULL, o indivíduo 0 é ele (sem perturbação). Se o tempo acabar (ou
+ * outra ilha mandar parar) no meio, a população fica só com os indivíduos já prontos; o 0
+ * sempre é feito.
+ */
+static void geraPopulacao(tIlha *ilha, int *primeiro)
+{
+    int n = ilha->n;
+    tTour *tour = initTour(n);
+
+    for (int i = 0; i < ilha->populacao; i++)
+    {
+        if (i > 0 && (atomic_load(ilha->parar) || agora() - ilha->inicio >= ilha->segundos))
+        {
+            ilha->populacao = i;
+            break;
+        }
+
+        if (primeiro && i == 0)
+            memcpy(ilha->ordem, primeiro, n * sizeof(int));
+        else
+            caminhamentoPreOrdem(ilha->MST, n, aleatorioIntervalo(ilha->aleatorio, n), ilha->ordem);
+
+        setCidadesTour(tour, ilha->ordem);
+        double comprimento = comprimentoTour(ilha->grafo, ilha->ordem, n);
+
+        // Perturbações antes do 2-opt: as pré-ordens sozinhas dão uma população pouco variada
+        if (!primeiro || i > 0)
+            for (int k = 0; k < n / PERTURBACOES_INICIAIS; k++)
+                comprimento += doubleBridge(ilha->grafo, tour, ilha->aleatorio);
+
+        ilha->comprimentos[i] = comprimento - doisOpt(ilha->grafo, ilha->vizinhos, tour);
+        linksDeTour(getCidadesTour(tour), n, ilha->links[i]);
+    }
+    freeTour(tour);
+
+    atualizaMelhor(ilha);
+}
+
+static void *executaIlha(void *arg)
+{
+    tIlha *ilha = (tIlha *)arg;
+    int semMelhora = 0;
+
+    inicializaIlha(ilha);
+
+    while (!atomic_load(ilha->parar) && agora() - ilha->inicio < ilha->segundos)
+    {
+        // População convergida: recomeça com indivíduos novos, mantendo o melhor da ilha
+        if (semMelhora >= GERACOES_SEM_MELHORA)
+        {
+            geraPopulacao(ilha, ilha->melhorTour);
+            ilha->reinicios++;
+            semMelhora = 0;
+        }
+
+        recebeMigrantes(ilha);
+
+        for (int i = 0; i < ilha->populacao; i++)
+            ilha->permutacao[i] = i;
+        embaralha(ilha->aleatorio, ilha->permutacao, ilha->populacao);
+
+        int melhorou = 0;
+        for (int i = 0; i < ilha->populacao; i++)
+        {
+            melhorou |= cruzamento(ilha, ilha->permutacao[i], ilha->permutacao[(i + 1) % ilha->populacao]);
+
+            if (atomic_load(ilha->parar) || agora() - ilha->inicio >= ilha->segundos)
+                break;
+        }
+
+        ilha->geracoes++;
+        atualizaMelhor(ilha);
+        semMelhora = melhorou ? 0 : semMelhora + 1;
+
+        if (ilha->geracoes % ilha->intervaloMigracao == 0)
+            enviaMigrante(ilha->saida, ilha->melhorTour, ilha->n);
+    }
+
+    freeAleatorio(ilha->aleatorio);
+    atomic_fetch_sub(ilha->ativas, 1);
+
+    return NULL;
+}
+
+double algoritmoGenetico(tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos, int *tourInicial, int ilhas,
+                         int populacao, double segundos, int intervaloMigracao, unsigned long long semente,
+                         double otimo, int *tourSaida)
+{
+    int n = getSizeVertices(grafo);
+
+    // EAX precisa de tours com vértices de grau 2 distintos
+    if (n < 8)
+    {
+        memcpy(tourSaida, tourInicial, n * sizeof(int));
+        return comprimentoTour(grafo, tourSaida, n);
+    }
+    if (intervaloMigracao < 1)
+        intervaloMigracao = 1;
+
+    _Atomic unsigned long long melhorGlobal = ~0ULL;
+    _Atomic int parar = 0;
+    _Atomic int ativas = ilhas;
+
+    tIlha *dados = (tIlha *)calloc(ilhas, sizeof(tIlha));
+    tFila *filas = (tFila *)malloc(ilhas * sizeof(tFila));
+    pthread_t *ids = (pthread_t *)malloc(ilhas * sizeof(pthread_t));
+    double inicio = agora();
+
+    for (int i = 0; i < ilhas; i++)
+    {
+        atomic_init(&filas[i].inicio, 0);
+        atomic_init(&filas[i].fim, 0);
+        filas[i].tours = (int *)malloc((size_t)CAPACIDADE_FILA * n * sizeof(int));
+    }
+
+    for (int i = 0; i < ilhas; i++)
+    {
+        tIlha *ilha = &dados[i];
+
+        ilha->id = i;
+        ilha->grafo = grafo;
+        ilha->MST = MST;
+        ilha->vizinhos = vizinhos;
+        ilha->tourInicial = tourInicial;
+        ilha->n = n;
+        ilha->populacao = populacao;
+        ilha->intervaloMigracao = intervaloMigracao;
+        ilha->segundos = segundos;
+        ilha->otimo = otimo;
+        ilha->inicio = inicio;
+        ilha->semente = semente;
+
+        // Anel: a ilha i recebe da i - 1 e manda para a i + 1
+        ilha->entrada = &filas[i];
+        ilha->saida = &filas[(i + 1) % ilhas];
+
+        ilha->melhorGlobal = &melhorGlobal;
+        ilha->parar = &parar;
+        ilha->ativas = &ativas;
+
+        pthread_create(&ids[i], NULL, executaIlha, ilha);
+    }
+
+    // Relatório: cada melhora do melhor global, com o tempo desde o início
+    unsigned long long ultima = ~0ULL;
+    struct timespec espera = {0, (long)(INTERVALO_RELATORIO * 1e9)};
+    while (1)
+    {
+        int fim = atomic_load(&ativas) == 0;
+        unsigned long long chave = atomic_load(&melhorGlobal);
+
+        if ((chave >> 32) != (ultima >> 32))
+        {
+            double comprimento = comprimentoChave(chave);
+            printf("[%8.2f s] AG: %.2f (ilha %d)", agora() - inicio, comprimento, (int)(chave & 0xFFFFFFFFULL));
+            if (otimo > 0)
+            {
+                // A chave guarda o comprimento em float: diferenças abaixo disso são zero
+                double gap = 100.0 * (comprimento - otimo) / otimo;
+                printf(", gap %.3f%%", fabs(gap) < 5e-4 ? 0.0 : gap);
+            }
+            printf("\n");
+            fflush(stdout);
+            ultima = chave;
+        }
+
+        if (fim)
+            break;
+        nanosleep(&espera, NULL);
+    }
+
+    int geracoes = 0, reinicios = 0;
+    int vencedora = 0;
+    for (int i = 0; i < ilhas; i++)
+    {
+        pthread_join(ids[i], NULL);
+        geracoes += dados[i].geracoes;
+        reinicios += dados[i].reinicios;
+        if (dados[i].melhorComprimento < dados[vencedora].melhorComprimento)
+            vencedora = i;
+    }
+
+    memcpy(tourSaida, dados[vencedora].melhorTour, n * sizeof(int));
+    printf("AG: %d gerações e %d reinícios em %d ilhas, %.2f s\n", geracoes, reinicios, ilhas, agora() - inicio);
+
+    for (int i = 0; i < ilhas; i++)
+    {
+        free(dados[i].pool.base);
+        free(filas[i].tours);
+    }
+    free(dados);
+    free(filas);
+    free(ids);
+
+    return comprimentoTour(grafo, tourSaida, n);
+}
@@ -0,0 +1,39 @@
+#ifndef GENETICO_H
+#define GENETICO_H
+
+#include "grafo.h"
+#include "vizinhos.h"
+
+/**
+ * @brief Algoritmo genético em ilhas com cruzamento EAX (edge assembly crossover)
+ * @details Cada ilha roda numa thread, com a própria população e toda a memória num pool
+ * alocado pela própria thread. A população inicial sai da pré-ordem da MST a partir de raízes
+ * sorteadas, melhorada por 2-opt; o primeiro indivíduo da ilha 0 é tourInicial.
+ * A cada geração os pares (A, B) vizinhos numa permutação aleatória da população geram filhos
+ * por EAX-1AB (um AB-ciclo de cada vez, subciclos reunidos pela melhor troca 2-opt entre
+ * candidatos); o melhor filho substitui A se for mais curto.
+ * A cada intervaloMigracao gerações a ilha manda o seu melhor tour para a seguinte (anel)
+ * por uma fila sem travas de um produtor e um consumidor; o migrante substitui o pior.
+ * Uma ilha para quando o tempo acaba, quando a população converge (gerações seguidas sem
+ * melhora) ou quando alguma ilha chega a otimo. Enquanto as ilhas rodam, a thread chamadora
+ * imprime cada melhora do melhor tour global, com o tempo e o gap para otimo (se otimo > 0).
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param vizinhos Listas de candidatos (2-opt e reunião dos subciclos)
+ * @param tourInicial Tour usado como primeiro indivíduo
+ * @param ilhas Quantidade de ilhas (threads)
+ * @param populacao Indivíduos por ilha
+ * @param segundos Tempo limite
+ * @param intervaloMigracao Gerações entre migrações
+ * @param semente Semente global (a ilha i usa uma derivada de (semente, i))
+ * @param otimo Comprimento de referência (ex.: de exemplos/opt), ou 0 se não houver
+ * @param tourSaida Vetor de saída, com Qtd_vértices posições
+ * @pre ilhas >= 1, populacao >= 2
+ * @return Comprimento do melhor tour
+ */
+double algoritmoGenetico(tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos, int *tourInicial, int ilhas,
+                         int populacao, double segundos, int intervaloMigracao, unsigned long long semente,
+                         double otimo, int *tourSaida);
+
+#endif
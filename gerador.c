@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "gerador.h"
+#include "aleatorio.h"
+#include "saida.h"
+
+#define PONTOS_POR_GRUPO 10
+
+static const char *nomes[] = {"uniforme", "agrupada", "grade"};
+
+int codigoDistribuicao(const char *nome)
+{
+    for (int i = 0; i < 3; i++)
+        if (!strcmp(nome, nomes[i]))
+            return i;
+    return -1;
+}
+
+const char *nomeDistribuicao(int distribuicao)
+{
+    return distribuicao >= 0 && distribuicao < 3 ? nomes[distribuicao] : "?";
+}
+
+static float limita(double v)
+{
+    if (v < 0)
+        v = 0;
+    if (v > LADO_GERADOR)
+        v = LADO_GERADOR;
+    return (float)floor(v + 0.5);
+}
+
+// Box-Muller: um sorteio normal padrão
+static double normal(tAleatorio *aleatorio)
+{
+    double u1 = aleatorioReal(aleatorio), u2 = aleatorioReal(aleatorio);
+    return sqrt(-2.0 * log(1.0 - u1)) * cos(2.0 * M_PI * u2);
+}
+
+tGrafo *geraInstancia(int distribuicao, int n, unsigned long long semente)
+{
+    tGrafo *grafo = initGrafo();
+    tVertice *vertice = initVertice(0, 0);
+    tAleatorio *aleatorio = initAleatorio(semente);
+
+    setSizeVertices(grafo, n);
+
+    if (distribuicao == DIST_AGRUPADA)
+    {
+        int qtdCentros = n / PONTOS_POR_GRUPO > 0 ? n / PONTOS_POR_GRUPO : 1;
+        double *centros = (double *)malloc(2 * qtdCentros * sizeof(double));
+        double desvio = LADO_GERADOR / sqrt((double)n);
+
+        for (int c = 0; c < 2 * qtdCentros; c++)
+            centros[c] = aleatorioReal(aleatorio) * LADO_GERADOR;
+
+        for (int i = 0; i < n; i++)
+        {
+            int c = aleatorioIntervalo(aleatorio, qtdCentros);
+            double x = centros[2 * c] + desvio * normal(aleatorio);
+            double y = centros[2 * c + 1] + desvio * normal(aleatorio);
+            reinitVertice(vertice, limita(x), limita(y));
+            setVertice(grafo, i, vertice);
+        }
+
+        free(centros);
+    }
+    else if (distribuicao == DIST_GRADE)
+    {
+        int lado = (int)ceil(sqrt((double)n));
+        double espacamento = (double)LADO_GERADOR / (lado > 1 ? lado : 1);
+
+        for (int i = 0; i < n; i++)
+        {
+            double x = (i % lado + 0.5) * espacamento + (aleatorioReal(aleatorio) - 0.5) * 0.2 * espacamento;
+            double y = (i / lado + 0.5) * espacamento + (aleatorioReal(aleatorio) - 0.5) * 0.2 * espacamento;
+            reinitVertice(vertice, limita(x), limita(y));
+            setVertice(grafo, i, vertice);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+        {
+            double x = aleatorioReal(aleatorio) * LADO_GERADOR;
+            double y = aleatorioReal(aleatorio) * LADO_GERADOR;
+            reinitVertice(vertice, limita(x), limita(y));
+            setVertice(grafo, i, vertice);
+        }
+    }
+
+    freeAleatorio(aleatorio);
+    freeVertice(vertice);
+
+    return grafo;
+}
+
+int salvaInstancia(const char *caminho, const char *nome, const char *comentario, tGrafo *grafo)
+{
+    tSaida *saida = initSaida(caminho);
+    if (!saida)
+        return 0;
+
+    int n = getSizeVertices(grafo);
+
+    escreveTextoSaida(saida, "NAME: ");
+    escreveTextoSaida(saida, nome);
+    escreveTextoSaida(saida, "\nCOMMENT: ");
+    escreveTextoSaida(saida, comentario);
+    escreveTextoSaida(saida, "\nTYPE: TSP\nDIMENSION: ");
+    escreveInteiroSaida(saida, n);
+    escreveTextoSaida(saida, "\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n");
+
+    // As coordenadas geradas são inteiras
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        escreveInteiroSaida(saida, i + 1);
+        escreveCharSaida(saida, ' ');
+        escreveInteiroSaida(saida, (long long)getX(v));
+        escreveCharSaida(saida, ' ');
+        escreveInteiroSaida(saida, (long long)getY(v));
+        escreveCharSaida(saida, '\n');
+    }
+    escreveTextoSaida(saida, "EOF\n");
+
+    return fechaSaida(saida);
+}
@@ -0,0 +1,54 @@
+#ifndef GERADOR_H
+#define GERADOR_H
+
+#include "grafo.h"
+
+#define LADO_GERADOR 1000000 // As coordenadas geradas ficam em [0, LADO_GERADOR]
+
+// Distribuições dos pontos
+#define DIST_UNIFORME 0
+#define DIST_AGRUPADA 1
+#define DIST_GRADE 2
+
+/**
+ * @brief Converte o nome da distribuição ("uniforme", "agrupada" ou "grade") para o código
+ *
+ * @param nome Nome da distribuição
+ * @return int DIST_*, ou -1 se o nome for desconhecido
+ */
+int codigoDistribuicao(const char *nome);
+
+/**
+ * @brief Nome da distribuição a partir do código
+ *
+ * @param distribuicao DIST_*
+ * @return const char*
+ */
+const char *nomeDistribuicao(int distribuicao);
+
+/**
+ * @brief Gera uma instância sintética com coordenadas inteiras
+ * @details Uniforme: pontos independentes no quadrado. Agrupada (como a do DIMACS Challenge):
+ * n / 10 centros uniformes, cada ponto normal em torno de um centro sorteado, desvio LADO / sqrt(n).
+ * Grade: as n primeiras posições de uma grade quadrada, cada uma deslocada até 10% do espaçamento.
+ * A mesma (distribuição, n, semente) sempre gera a mesma instância.
+ *
+ * @param distribuicao DIST_*
+ * @param n Quantidade de vértices
+ * @param semente Semente do gerador
+ * @return tGrafo* só com o vetor de vértices (liberar com freeGrafo)
+ */
+tGrafo *geraInstancia(int distribuicao, int n, unsigned long long semente);
+
+/**
+ * @brief Salva o grafo no formato .tsp do TSPLIB (EUC_2D), como os de exemplos/in
+ *
+ * @param caminho Arquivo de saída
+ * @param nome Nome da instância (linha NAME)
+ * @param comentario Linha COMMENT
+ * @param grafo Grafo com o vetor de vértices
+ * @return int 1 se gravou, 0 se houve erro
+ */
+int salvaInstancia(const char *caminho, const char *nome, const char *comentario, tGrafo *grafo);
+
+#endif
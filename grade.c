@@ -0,0 +1,346 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "grade.h"
+
+typedef struct
+{
+    int id;
+    float x, y;
+} tPontoGrade;
+
+typedef struct
+{
+    unsigned long long chave; // Coordenadas (cx, cy) da célula juntas
+    int ocupada;
+    int qtd, capacidade;
+    tPontoGrade *pontos;
+} tCelula;
+
+struct stGrade
+{
+    float tamCelula;
+
+    tCelula *tabela; // Endereçamento aberto, tamanho potência de 2
+    int capacidade;
+    int qtdCelulas;
+    int qtdPontos;
+
+    // Células extremas já ocupadas: limitam até onde a busca precisa ir
+    int minCx, maxCx, minCy, maxCy;
+
+    // Espaço de trabalho da busca
+    float *dists;
+    int capDists;
+};
+
+// Sem sinal: cx negativo não pode ser deslocado como long long
+static unsigned long long chaveCelula(int cx, int cy)
+{
+    return ((unsigned long long)(unsigned int)cx << 32) | (unsigned int)cy;
+}
+
+static unsigned int espalha(unsigned long long chave)
+{
+    unsigned long long z = chave * 0x9E3779B97F4A7C15ULL;
+    return (unsigned int)(z >> 32);
+}
+
+static int coordCelula(float valor, float tamCelula)
+{
+    return (int)floorf(valor / tamCelula);
+}
+
+tGrade *initGrade(float tamCelula)
+{
+    tGrade *grade = (tGrade *)malloc(sizeof(tGrade));
+
+    grade->tamCelula = tamCelula;
+    grade->capacidade = 64;
+    grade->tabela = (tCelula *)calloc(grade->capacidade, sizeof(tCelula));
+    grade->qtdCelulas = 0;
+    grade->qtdPontos = 0;
+    grade->minCx = grade->minCy = 0;
+    grade->maxCx = grade->maxCy = -1;
+    grade->dists = NULL;
+    grade->capDists = 0;
+
+    return grade;
+}
+
+void freeGrade(tGrade *grade)
+{
+    for (int i = 0; i < grade->capacidade; i++)
+        free(grade->tabela[i].pontos);
+
+    free(grade->tabela);
+    free(grade->dists);
+    free(grade);
+}
+
+static tCelula *achaCelula(tGrade *grade, int cx, int cy, int cria)
+{
+    unsigned long long chave = chaveCelula(cx, cy);
+    unsigned int mascara = grade->capacidade - 1;
+    unsigned int i = espalha(chave) & mascara;
+
+    while (grade->tabela[i].ocupada)
+    {
+        if (grade->tabela[i].chave == chave)
+            return &(grade->tabela[i]);
+        i = (i + 1) & mascara;
+    }
+
+    if (!cria)
+        return NULL;
+
+    grade->tabela[i].ocupada = 1;
+    grade->tabela[i].chave = chave;
+    grade->qtdCelulas++;
+
+    return &(grade->tabela[i]);
+}
+
+// Dobra a tabela quando passa de metade cheia (células vazias continuam na tabela)
+static void cresceTabela(tGrade *grade)
+{
+    tCelula *antiga = grade->tabela;
+    int capAntiga = grade->capacidade;
+
+    grade->capacidade *= 2;
+    grade->tabela = (tCelula *)calloc(grade->capacidade, sizeof(tCelula));
+
+    unsigned int mascara = grade->capacidade - 1;
+    for (int c = 0; c < capAntiga; c++)
+    {
+        if (!antiga[c].ocupada)
+            continue;
+
+        unsigned int i = espalha(antiga[c].chave) & mascara;
+        while (grade->tabela[i].ocupada)
+            i = (i + 1) & mascara;
+        grade->tabela[i] = antiga[c];
+    }
+
+    free(antiga);
+}
+
+void insereGrade(tGrade *grade, int id, float x, float y)
+{
+    if (2 * (grade->qtdCelulas + 1) > grade->capacidade)
+        cresceTabela(grade);
+
+    int cx = coordCelula(x, grade->tamCelula);
+    int cy = coordCelula(y, grade->tamCelula);
+    tCelula *celula = achaCelula(grade, cx, cy, 1);
+
+    if (celula->qtd == celula->capacidade)
+    {
+        celula->capacidade = celula->capacidade ? 2 * celula->capacidade : 4;
+        celula->pontos = (tPontoGrade *)realloc(celula->pontos, celula->capacidade * sizeof(tPontoGrade));
+    }
+
+    celula->pontos[celula->qtd].id = id;
+    celula->pontos[celula->qtd].x = x;
+    celula->pontos[celula->qtd].y = y;
+    celula->qtd++;
+
+    if (grade->qtdPontos == 0)
+    {
+        grade->minCx = grade->maxCx = cx;
+        grade->minCy = grade->maxCy = cy;
+    }
+    else
+    {
+        if (cx < grade->minCx)
+            grade->minCx = cx;
+        if (cx > grade->maxCx)
+            grade->maxCx = cx;
+        if (cy < grade->minCy)
+            grade->minCy = cy;
+        if (cy > grade->maxCy)
+            grade->maxCy = cy;
+    }
+
+    grade->qtdPontos++;
+}
+
+int removeGrade(tGrade *grade, int id, float x, float y)
+{
+    tCelula *celula = achaCelula(grade, coordCelula(x, grade->tamCelula), coordCelula(y, grade->tamCelula), 0);
+
+    if (!celula)
+        return 0;
+
+    for (int i = 0; i < celula->qtd; i++)
+    {
+        if (celula->pontos[i].id == id)
+        {
+            celula->pontos[i] = celula->pontos[--celula->qtd];
+            grade->qtdPontos--;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int buscaVizinhosGrade(tGrade *grade, float x, float y, int k, int ignorar, int *saida)
+{
+    if (k <= 0 || grade->qtdPontos == 0)
+        return 0;
+
+    if (k > grade->capDists)
+    {
+        grade->capDists = k;
+        grade->dists = (float *)realloc(grade->dists, k * sizeof(float));
+    }
+
+    int cx = coordCelula(x, grade->tamCelula);
+    int cy = coordCelula(y, grade->tamCelula);
+    int qtd = 0;
+
+    // Anel a partir do qual não existe mais nenhuma célula ocupada
+    int maxAnel = 0;
+    int limites[4] = {cx - grade->minCx, grade->maxCx - cx, cy - grade->minCy, grade->maxCy - cy};
+    for (int i = 0; i < 4; i++)
+        if (limites[i] > maxAnel)
+            maxAnel = limites[i];
+
+    for (int anel = 0; anel <= maxAnel; anel++)
+    {
+        for (int py = cy - anel; py <= cy + anel; py++)
+        {
+            int passo = (py == cy - anel || py == cy + anel) ? 1 : 2 * anel;
+            if (passo == 0)
+                passo = 1;
+
+            for (int px = cx - anel; px <= cx + anel; px += passo)
+            {
+                tCelula *celula = achaCelula(grade, px, py, 0);
+                if (!celula)
+                    continue;
+
+                for (int i = 0; i < celula->qtd; i++)
+                {
+                    tPontoGrade *p = &(celula->pontos[i]);
+                    if (p->id == ignorar)
+                        continue;
+
+                    float dx = p->x - x, dy = p->y - y;
+                    float d = dx * dx + dy * dy;
+                    if (qtd == k && d >= grade->dists[k - 1])
+                        continue;
+
+                    // Inserção ordenada entre os k melhores
+                    int pos = qtd < k ? qtd++ : k - 1;
+                    while (pos > 0 && grade->dists[pos - 1] > d)
+                    {
+                        saida[pos] = saida[pos - 1];
+                        grade->dists[pos] = grade->dists[pos - 1];
+                        pos--;
+                    }
+                    saida[pos] = p->id;
+                    grade->dists[pos] = d;
+                }
+            }
+        }
+
+        // Pontos fora deste anel estão a pelo menos anel * tamCelula
+        float alcance = anel * grade->tamCelula;
+        if (qtd == k && grade->dists[k - 1] <= alcance * alcance)
+            break;
+    }
+
+    return qtd;
+}
+
+// Setor de 45 graus (0..7) em que o vetor (dx, dy) cai
+static int setor(float dx, float dy)
+{
+    int s;
+
+    if (dy >= 0)
+        s = dx > 0 ? (dx > dy ? 0 : 1) : (-dx < dy ? 2 : 3);
+    else
+        s = dx <= 0 ? (-dx > -dy ? 4 : 5) : (dx < -dy ? 6 : 7);
+
+    return s;
+}
+
+int buscaConesGrade(tGrade *grade, float x, float y, int ignorar, int *saida)
+{
+    float dists[8];
+    int qtd = 0;
+
+    for (int s = 0; s < 8; s++)
+        saida[s] = -1;
+
+    if (grade->qtdPontos == 0)
+        return 0;
+
+    int cx = coordCelula(x, grade->tamCelula);
+    int cy = coordCelula(y, grade->tamCelula);
+
+    // Em cada setor um eixo domina (|dx| >= |dy| ou o contrário), então o setor só tem pontos
+    // até o anel em que a grade acaba na direção desse eixo (+1 pelo arredondamento das células)
+    int limites[4] = {grade->maxCx - cx, grade->maxCy - cy, cx - grade->minCx, cy - grade->minCy};
+    int limiteSetor[8];
+    int maxAnel = 0;
+    for (int s = 0; s < 8; s++)
+    {
+        limiteSetor[s] = limites[((s + 1) / 2) % 4] + 1;
+        if (limiteSetor[s] > maxAnel)
+            maxAnel = limiteSetor[s];
+    }
+
+    for (int anel = 0; anel <= maxAnel; anel++)
+    {
+        for (int py = cy - anel; py <= cy + anel; py++)
+        {
+            int passo = (py == cy - anel || py == cy + anel) ? 1 : 2 * anel;
+            if (passo == 0)
+                passo = 1;
+
+            for (int px = cx - anel; px <= cx + anel; px += passo)
+            {
+                tCelula *celula = achaCelula(grade, px, py, 0);
+                if (!celula)
+                    continue;
+
+                for (int i = 0; i < celula->qtd; i++)
+                {
+                    tPontoGrade *p = &(celula->pontos[i]);
+                    float dx = p->x - x, dy = p->y - y;
+                    if (p->id == ignorar)
+                        continue;
+
+                    int s = setor(dx, dy);
+                    float d = dx * dx + dy * dy;
+                    if (saida[s] < 0 || d < dists[s] || (d == dists[s] && p->id < saida[s]))
+                    {
+                        if (saida[s] < 0)
+                            qtd++;
+                        saida[s] = p->id;
+                        dists[s] = d;
+                    }
+                }
+            }
+        }
+
+        // Para quando cada setor já tem alguém mais perto que o próximo anel, ou já acabou
+        float alcance = anel * grade->tamCelula;
+        int pronto = 1;
+        for (int s = 0; s < 8 && pronto; s++)
+            pronto = saida[s] >= 0 ? dists[s] <= alcance * alcance : anel >= limiteSetor[s];
+        if (pronto)
+            break;
+    }
+
+    return qtd;
+}
+
+int getQtdGrade(tGrade *grade)
+{
+    return grade->qtdPontos;
+}
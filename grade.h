@@ -0,0 +1,80 @@
+#ifndef GRADE_H
+#define GRADE_H
+
+typedef struct stGrade tGrade;
+
+/**
+ * @brief Cria uma grade espacial vazia, com células quadradas de lado fixo
+ * @details As células são guardadas em uma tabela hash, então a grade não precisa conhecer
+ * a área dos pontos de antemão e aceita inserções e remoções a qualquer momento.
+ *
+ * @param tamCelula Lado de cada célula (idealmente perto da distância típica entre vizinhos)
+ * @pre tamCelula > 0
+ * @return tGrade*
+ */
+tGrade *initGrade(float tamCelula);
+
+/**
+ * @brief Destrói a grade
+ *
+ * @param grade Grade a ser liberada
+ */
+void freeGrade(tGrade *grade);
+
+/**
+ * @brief Insere um ponto na grade
+ *
+ * @param grade Grade
+ * @param id Identificador do ponto
+ * @param x Coordenada x
+ * @param y Coordenada y
+ */
+void insereGrade(tGrade *grade, int id, float x, float y);
+
+/**
+ * @brief Remove um ponto da grade
+ *
+ * @param grade Grade
+ * @param id Identificador do ponto
+ * @param x Coordenada x com que ele foi inserido
+ * @param y Coordenada y com que ele foi inserido
+ * @return 1 se removeu, 0 se o ponto não estava lá
+ */
+int removeGrade(tGrade *grade, int id, float x, float y);
+
+/**
+ * @brief Busca os k pontos mais próximos de (x, y)
+ *
+ * @param grade Grade
+ * @param x Coordenada x da consulta
+ * @param y Coordenada y da consulta
+ * @param k Quantidade máxima de vizinhos
+ * @param ignorar Identificador a ser pulado (ex.: o próprio ponto), ou -1
+ * @param saida Vetor com k posições, preenchido do mais próximo para o mais distante
+ * @return Quantidade de vizinhos encontrados
+ */
+int buscaVizinhosGrade(tGrade *grade, float x, float y, int k, int ignorar, int *saida);
+
+/**
+ * @brief Busca o ponto mais próximo de (x, y) em cada um dos 8 setores de 45 graus em volta dele
+ * @details As arestas até esses pontos (grafo de Yao) contêm todas as arestas da MST euclidiana
+ * que tocam (x, y). Setores sem nenhum ponto ficam com -1.
+ *
+ * @param grade Grade
+ * @param x Coordenada x da consulta
+ * @param y Coordenada y da consulta
+ * @param ignorar Identificador a ser pulado (ex.: o próprio ponto), ou -1
+ * @param saida Vetor com 8 posições, uma por setor
+ * @return Quantidade de setores com algum ponto
+ */
+int buscaConesGrade(tGrade *grade, float x, float y, int ignorar, int *saida);
+
+/**
+ * @brief Pega a quantidade de pontos na grade
+ *
+ * @param grade Grade
+ * @return int
+ */
+int getQtdGrade(tGrade *grade);
+
+#endif
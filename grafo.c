@@ -39,6 +39,10 @@ static void freeVertices(tGrafo *grafo);
 static void freeArestas(tGrafo *grafo);
 static int compAresta(const void *aresta_1, const void *aresta_2);
 
+// Desempate da compAresta (NULL: os próprios índices); o qsort não recebe contexto.
+// Só é mudado por sortArestasPorIds, antes de qualquer thread
+static const int *idsDesempate = NULL;
+
 // =========== Funções do Grafo =========== //
 
 tGrafo *initGrafo()
@@ -106,34 +110,62 @@ static void freeVertices(tGrafo *grafo)
  * @pre
  * @post
  */
-tAresta **kruskalAlgorithm(tGrafo *grafo, FILE *outFileMST, FILE *outFileTour)
+tAresta **kruskalAlgorithm(tGrafo *grafo)
 {
     int size = getSizeVertices(grafo);
 
     tUF *F = InitUnionFind(size);
-    tAresta **S = grafo->arestas;
+    tAresta *S = grafo->arestas;
 
     // A MST é um vetor de arestas que serão salvas durante a execução do algoritmo
-    tAresta **MST = (tAresta **)malloc(sizeof(tAresta *) * (getSizeVertices(grafo) - 1));
+    // (cópias próprias, para a MST sobreviver ao vetor de arestas do grafo)
+    tAresta **MST = initMST(grafo, NULL, getSizeVertices(grafo) - 1);
 
     int i = 0, j = 0;
     float pesoTotalMST = 0;
-    while (/* !isEmpty(S) */ i < getSizeArestas(grafo) && !isSpanning(F))
+    // Com size - 1 uniões a UF já é spanning: contar evita o isSpanning (O(n)) a cada aresta
+    while (/* !isEmpty(S) */ i < getSizeArestas(grafo) && j < size - 1)
     {
-        tAresta *menorAresta = S[i++];
+        tAresta *menorAresta = &S[i++];
         if (!IsConnected(F, getV1(menorAresta), getV2(menorAresta)))
         {
             Union(F, getV1(menorAresta), getV2(menorAresta));
-            MST[j++] = menorAresta;
-
-            fprintf(outFileMST, "%d %d\n", getV1(menorAresta) + 1, getV2(menorAresta) + 1);
+            *MST[j++] = *menorAresta;
             pesoTotalMST += getDist(menorAresta);
         }
     }
 
+    freeUnionFind(F);
+
     return MST;
 }
 
+tAresta **initMST(tGrafo *grafo, const int *pares, int qtd)
+{
+    if (qtd < 1)
+        qtd = 1;
+
+    // Um bloco só para as arestas: MST[0] aponta para o início dele
+    tAresta *bloco = (tAresta *)calloc(qtd, sizeof(tAresta));
+    tAresta **MST = (tAresta **)malloc(sizeof(tAresta *) * qtd);
+
+    for (int i = 0; i < qtd; i++)
+    {
+        MST[i] = &bloco[i];
+
+        if (pares)
+            reinitAresta(grafo, MST[i], pares[2 * i], pares[2 * i + 1]);
+    }
+
+    return MST;
+}
+
+void freeMST(tAresta **MST)
+{
+    free(MST[0]);
+    free(MST);
+}
+
 // =========== Funções da Aresta =========== //
 
 tAresta *initAresta(tGrafo *grafo, int indice1, int indice2)
@@ -174,6 +206,10 @@ void reinitAresta(tGrafo *grafo, tAresta *aresta, int indice1, int indice2)
 
 void initAllArestas(tGrafo *grafo)
 {
+    freeArestas(grafo);
+    if (getSizeArestas(grafo) > 0)
+        grafo->arestas = (tAresta *)malloc((size_t)getSizeArestas(grafo) * sizeof(tAresta));
+
     // Essa aresta será o "esqueleto" para montar arestas.
     tAresta *aresta = initAresta(grafo, 0, 0);
     int indice = 0;
@@ -243,7 +279,15 @@ static int compAresta(const void *aresta_1, const void *aresta_2)
     if (getDist(a1) > getDist(a2))
         return 1;
 
-    return 0;
+    // Empate: pelo par de pontas, para a ordem não depender do qsort
+    int u1 = idsDesempate ? idsDesempate[a1->v1] : a1->v1;
+    int u2 = idsDesempate ? idsDesempate[a2->v1] : a2->v1;
+    if (u1 != u2)
+        return u1 < u2 ? -1 : 1;
+
+    u1 = idsDesempate ? idsDesempate[a1->v2] : a1->v2;
+    u2 = idsDesempate ? idsDesempate[a2->v2] : a2->v2;
+    return (u1 > u2) - (u1 < u2);
 }
 
 void sortArestas(tGrafo *grafo)
@@ -251,6 +295,38 @@ void sortArestas(tGrafo *grafo)
     qsort(grafo->arestas, getSizeArestas(grafo), sizeof(tAresta), compAresta);
 }
 
+void sortArestasPorIds(tGrafo *grafo, const int *ids)
+{
+    int qtd = getSizeArestas(grafo);
+
+    for (int i = 0; i < qtd; i++)
+    {
+        tAresta *aresta = &(grafo->arestas[i]);
+        if (ids[aresta->v1] > ids[aresta->v2])
+        {
+            int aux = aresta->v1;
+            aresta->v1 = aresta->v2;
+            aresta->v2 = aux;
+        }
+    }
+
+    idsDesempate = ids;
+    qsort(grafo->arestas, qtd, sizeof(tAresta), compAresta);
+    idsDesempate = NULL;
+}
+
+float distVertices(tGrafo *grafo, int indice1, int indice2)
+{
+    // Acesso direto ao vetor: essa função é chamada no laço interno das buscas locais
+    tVertice *v1 = &(grafo->vertices[indice1]);
+    tVertice *v2 = &(grafo->vertices[indice2]);
+
+    float x = v1->x - v2->x;
+    float y = v1->y - v2->y;
+
+    return sqrtf(x * x + y * y);
+}
+
 // ----------------- Getters e Setters daqui para baixo ----------------- //
 
 // ========= Getters e Setters do grafo ========= //
@@ -268,17 +344,8 @@ void setSizeVertices(tGrafo *grafo, int size)
     else
         grafo->vertices = (tVertice *)calloc(size, sizeof(tVertice));
 
-    // Quantidade de arestas == Qtd_vértices*(Qtd_vértices - 1) / 2
-    size = size * (size - 1) / 2;
-
-    if (size < 1)
-        freeArestas(grafo);
-
-    else if (grafo->arestas)
-        grafo->arestas = (tAresta *)realloc(grafo->arestas, size * sizeof(tAresta));
-
-    else
-        grafo->arestas = (tAresta *)calloc(size, sizeof(tAresta));
+    // As arestas dependem dos vértices: ficam para a initAllArestas
+    freeArestas(grafo);
 }
 
 int getSizeVertices(tGrafo *grafo)
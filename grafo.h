@@ -92,6 +92,7 @@ void reinitAresta(tGrafo *grafo, tAresta *aresta, int indice1, int indice2);
 
 /**
  * @brief Cria todas as arestas possíveis do grafo
+ * @details O vetor de arestas (Qtd_vértices*(Qtd_vértices - 1) / 2 posições) só é alocado aqui.
  *
  * @param grafo Grafo com os vértices
  * @pre Vetor de vértices completamente preenchido
@@ -101,24 +102,76 @@ void initAllArestas(tGrafo *grafo);
 
 /**
  * @brief Organiza as arestas em ordem crescente
+ * @details Empates ficam pelo par (v1, v2), a ordem em que initAllArestas as cria.
  *
  * @param grafo Grafo com as arestas
  */
 void sortArestas(tGrafo *grafo);
 
+/**
+ * @brief Organiza as arestas em ordem crescente, com empates pelos ids dados
+ * @details Cada aresta é orientada para ids[v1] < ids[v2] e os empates ficam pelo par
+ * (ids[v1], ids[v2]). Com os vértices renumerados e ids[novo] == id original, a ordem (e
+ * portanto a MST e o caminhamento) é a mesma da instância sem renumerar.
+ *
+ * @param grafo Grafo com as arestas
+ * @param ids Chave de desempate de cada vértice (uma permutação)
+ */
+void sortArestasPorIds(tGrafo *grafo, const int *ids);
+
 void imprimeArestas(tGrafo *grafo);
 
-tAresta **kruskalAlgorithm(tGrafo *grafo, FILE *outFileMST, FILE *outFileTour);
+/**
+ * @brief Calcula a distância euclidiana entre dois vértices do grafo
+ * @details Não depende do vetor de arestas, então serve mesmo sem initAllArestas.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param indice1 Índice do primeiro vértice
+ * @param indice2 Índice do segundo vértice
+ * @return float
+ */
+float distVertices(tGrafo *grafo, int indice1, int indice2);
+
+/**
+ * @brief Gera a MST pelo algoritmo de Kruskal
+ * @details Não escreve nada: as arestas ficam na ordem em que foram escolhidas e a saída
+ * é gravada depois, de uma vez (ver saida.h).
+ *
+ * @param grafo Grafo com o vetor de arestas ordenado
+ * @pre sortArestas já foi chamada
+ * @return tAresta** (liberar com freeMST)
+ */
+tAresta **kruskalAlgorithm(tGrafo *grafo);
+
+/**
+ * @brief Monta uma MST a partir dos pares de vértices das suas arestas
+ * @details Usado quando a MST já é conhecida (ex.: cache), sem precisar do vetor de arestas.
+ * As arestas são cópias próprias, como as da kruskalAlgorithm.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param pares Vetor com 2 * qtd índices: v1 e v2 de cada aresta
+ * @param qtd Quantidade de arestas
+ * @return tAresta**
+ */
+tAresta **initMST(tGrafo *grafo, const int *pares, int qtd);
+
+/**
+ * @brief Destrói uma MST retornada por kruskalAlgorithm ou initMST
+ *
+ * @param MST MST a ser liberada
+ */
+void freeMST(tAresta **MST);
 
 // Funções getters e setters (Grafo)
 
 /**
- * @brief Define quantos vértices o grafo terá. (E quantas arestas)
+ * @brief Define quantos vértices o grafo terá.
+ * @details Arestas antigas deixam de valer e são liberadas; initAllArestas aloca as novas.
  *
  * @param grafo Grafo a ser modificado
  * @param size Tamanho do vetor de vértices
  * @pre Grafo não é NULL, size >= 0
- * @post Tamanho de vetor de vértices e de arestas foram ajustados
+ * @post Tamanho do vetor de vértices foi ajustado e o vetor de arestas é NULL
  */
 void setSizeVertices(tGrafo *grafo, int size);
 
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "hilbert.h"
+
+#define BITS_HILBERT 16
+
+// Índice da célula (x, y) na curva de Hilbert de lado 2^BITS_HILBERT
+static unsigned long long indiceHilbert(unsigned int x, unsigned int y)
+{
+    unsigned long long d = 0;
+
+    for (unsigned int s = 1u << (BITS_HILBERT - 1); s > 0; s >>= 1)
+    {
+        unsigned int rx = (x & s) > 0;
+        unsigned int ry = (y & s) > 0;
+        d += (unsigned long long)s * s * ((3 * rx) ^ ry);
+
+        // Gira o quadrante para a curva continuar no nível de baixo
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = s - 1 - (x & (s - 1));
+                y = s - 1 - (y & (s - 1));
+            }
+            unsigned int t = x;
+            x = y;
+            y = t;
+        }
+        x &= s - 1;
+        y &= s - 1;
+    }
+
+    return d;
+}
+
+static int compChave(const void *p1, const void *p2)
+{
+    unsigned long long a = *(const unsigned long long *)p1;
+    unsigned long long b = *(const unsigned long long *)p2;
+
+    return (a > b) - (a < b);
+}
+
+int *ordemHilbert(tGrafo *grafo)
+{
+    int n = getSizeVertices(grafo);
+
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        if (i == 0 || getX(v) < minX)
+            minX = getX(v);
+        if (i == 0 || getX(v) > maxX)
+            maxX = getX(v);
+        if (i == 0 || getY(v) < minY)
+            minY = getY(v);
+        if (i == 0 || getY(v) > maxY)
+            maxY = getY(v);
+    }
+
+    // Mesma escala nos dois eixos, para a curva não distorcer
+    double lado = maxX - minX > maxY - minY ? maxX - minX : maxY - minY;
+    double escala = lado > 0 ? ((1u << BITS_HILBERT) - 1) / lado : 0;
+
+    // Chave: índice na curva (32 bits) em cima, id original embaixo
+    unsigned long long *chaves = (unsigned long long *)malloc((n > 0 ? n : 1) * sizeof(unsigned long long));
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        unsigned int x = (unsigned int)((getX(v) - minX) * escala);
+        unsigned int y = (unsigned int)((getY(v) - minY) * escala);
+        chaves[i] = (indiceHilbert(x, y) << 32) | (unsigned int)i;
+    }
+
+    qsort(chaves, n, sizeof(unsigned long long), compChave);
+
+    int *ordem = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    for (int i = 0; i < n; i++)
+        ordem[i] = (int)(chaves[i] & 0xFFFFFFFFu);
+
+    free(chaves);
+
+    return ordem;
+}
+
+// Reordena as coordenadas: novo[i] = antigo[origem(i)], com origem dada por ordem ou pela inversa
+static void permutaGrafo(tGrafo *grafo, int *ordem, int inversa)
+{
+    int n = getSizeVertices(grafo);
+    float *xs = (float *)malloc((n > 0 ? n : 1) * sizeof(float));
+    float *ys = (float *)malloc((n > 0 ? n : 1) * sizeof(float));
+
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        xs[i] = getX(v);
+        ys[i] = getY(v);
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        // Renumerar: o novo i é o antigo ordem[i]. Restaurar: o original ordem[i] é o novo i
+        int destino = inversa ? ordem[i] : i;
+        int origem = inversa ? i : ordem[i];
+        tVertice *v = getVertice(grafo, destino);
+        setX(v, xs[origem]);
+        setY(v, ys[origem]);
+    }
+
+    free(xs);
+    free(ys);
+}
+
+void renumeraGrafo(tGrafo *grafo, int *ordem)
+{
+    permutaGrafo(grafo, ordem, 0);
+}
+
+void restauraGrafo(tGrafo *grafo, int *ordem)
+{
+    permutaGrafo(grafo, ordem, 1);
+}
+
+void traduzIds(int *vetor, long long tam, int *ordem)
+{
+    for (long long i = 0; i < tam; i++)
+        vetor[i] = ordem[vetor[i]];
+}
+
+void traduzMST(tAresta **MST, int qtd, int *ordem)
+{
+    for (int i = 0; i < qtd; i++)
+    {
+        setV1(MST[i], ordem[getV1(MST[i])]);
+        setV2(MST[i], ordem[getV2(MST[i])]);
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef HILBERT_H
+#define HILBERT_H
+
+#include "grafo.h"
+
+/**
+ * @brief Calcula a ordem dos vértices ao longo de uma curva de Hilbert
+ * @details A caixa envolvente é dividida numa grade de 2^16 x 2^16 e cada vértice recebe o
+ * índice da sua célula na curva; vértices próximos no plano ficam próximos na ordem.
+ * Empates ficam na ordem original.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @return int* ordem[novo] == id original (liberar com free)
+ */
+int *ordemHilbert(tGrafo *grafo);
+
+/**
+ * @brief Renumera os vértices do grafo: o vértice novo i passa a ser o original ordem[i]
+ *
+ * @param grafo Grafo só com o vetor de vértices (sem arestas)
+ * @param ordem Permutação de 0..Qtd_vértices-1
+ */
+void renumeraGrafo(tGrafo *grafo, int *ordem);
+
+/**
+ * @brief Desfaz renumeraGrafo: volta os vértices para os ids originais
+ *
+ * @param grafo Grafo renumerado com ordem
+ * @param ordem A mesma permutação usada em renumeraGrafo
+ */
+void restauraGrafo(tGrafo *grafo, int *ordem);
+
+/**
+ * @brief Traduz ids renumerados para os originais (vetor[i] = ordem[vetor[i]])
+ * @details Serve para tours, pares de arestas e listas de candidatos.
+ *
+ * @param vetor Ids no espaço renumerado
+ * @param tam Quantidade de ids
+ * @param ordem A permutação usada em renumeraGrafo
+ */
+void traduzIds(int *vetor, long long tam, int *ordem);
+
+/**
+ * @brief Traduz as pontas das arestas da MST para os ids originais
+ *
+ * @param MST Vetor de arestas no espaço renumerado
+ * @param qtd Quantidade de arestas
+ * @param ordem A permutação usada em renumeraGrafo
+ */
+void traduzMST(tAresta **MST, int qtd, int *ordem);
+
+#endif
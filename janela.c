@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "janela.h"
+#include "tempo.h"
+#include "tour.h"
+
+#define EPSILON_JANELA 1e-7 // Melhora mínima (relativa ao trecho) para reescrever a janela
+
+typedef struct stJanelas tJanelas;
+
+// Espaço de cada thread: reservado uma vez e reaproveitado em todas as janelas
+typedef struct
+{
+    int id;
+    tJanelas *comum;
+
+    double *dp;          // dp[mask * m + ultima]: menor caminho da ponta inicial por mask, terminando em ultima
+    unsigned char *pai;  // Penúltima cidade do caminho de dp
+    float bloco[MAX_JANELA * MAX_JANELA]; // Distâncias entre as cidades da janela
+    int cidades[MAX_JANELA];
+
+    int melhoradas;
+} tTrabalhadorJanela;
+
+struct stJanelas
+{
+    tGrafo *grafo;
+    int *tour;
+    int n, k, passadas, threads;
+
+    // Uma janela só é resolvida de novo se alguma posição dela mudou desde a última vez
+    int *mudou;     // mudou[pos]: fase (contada desde o início) em que a posição foi reescrita
+    int *resolvida; // resolvida[inicio]: fase seguinte à última resolução da janela
+
+    pthread_barrier_t barreira;
+    _Atomic int melhorasPassada[2]; // Alternados: um é zerado enquanto o outro é lido
+    int passadasFeitas;
+};
+
+// Resolve a janela que começa na posição inicio; retorna 1 se o trecho foi reescrito
+static int resolveJanela(tTrabalhadorJanela *t, int inicio, int fase)
+{
+    tJanelas *j = t->comum;
+    int n = j->n, k = j->k, m = k - 2;
+    float *d = t->bloco;
+
+    int precisa = j->resolvida[inicio] < 0;
+    for (int i = 0; i < k && !precisa; i++)
+        precisa = j->mudou[(inicio + i) % n] >= j->resolvida[inicio];
+    if (!precisa)
+        return 0;
+    j->resolvida[inicio] = fase + 1;
+
+    for (int i = 0; i < k; i++)
+        t->cidades[i] = j->tour[(inicio + i) % n];
+
+    for (int a = 0; a < k; a++)
+    {
+        d[a * k + a] = 0;
+        for (int b = a + 1; b < k; b++)
+            d[a * k + b] = d[b * k + a] = distVertices(j->grafo, t->cidades[a], t->cidades[b]);
+    }
+
+    double atual = 0;
+    for (int i = 0; i + 1 < k; i++)
+        atual += d[i * k + i + 1];
+
+    // Held-Karp: ponta inicial é o índice 0 do bloco, as do meio 1 .. m, a final k - 1
+    int cheio = (1 << m) - 1;
+    for (int s = 0; s < (m << m); s++)
+        t->dp[s] = HUGE_VAL;
+    for (int i = 0; i < m; i++)
+        t->dp[(1 << i) * m + i] = d[1 + i];
+
+    for (int mask = 1; mask < cheio; mask++)
+    {
+        for (int ultima = 0; ultima < m; ultima++)
+        {
+            double valor = t->dp[mask * m + ultima];
+            if (!(mask >> ultima & 1) || valor == HUGE_VAL)
+                continue;
+
+            const float *linha = &d[(1 + ultima) * k + 1];
+            for (int proxima = 0; proxima < m; proxima++)
+            {
+                if (mask >> proxima & 1)
+                    continue;
+
+                int novo = (mask | 1 << proxima) * m + proxima;
+                double candidato = valor + linha[proxima];
+                if (candidato < t->dp[novo])
+                {
+                    t->dp[novo] = candidato;
+                    t->pai[novo] = ultima;
+                }
+            }
+        }
+    }
+
+    double melhor = HUGE_VAL;
+    int ultima = -1;
+    for (int i = 0; i < m; i++)
+    {
+        double valor = t->dp[cheio * m + i] + d[(1 + i) * k + k - 1];
+        if (valor < melhor)
+        {
+            melhor = valor;
+            ultima = i;
+        }
+    }
+
+    if (ultima < 0 || melhor >= atual - EPSILON_JANELA * atual)
+        return 0;
+
+    // Reescreve o meio da janela de trás para frente
+    int mask = cheio;
+    for (int pos = m; pos >= 1; pos--)
+    {
+        j->tour[(inicio + pos) % n] = t->cidades[1 + ultima];
+        j->mudou[(inicio + pos) % n] = fase;
+        int anterior = t->pai[mask * m + ultima];
+        mask ^= 1 << ultima;
+        ultima = anterior;
+    }
+
+    t->melhoradas++;
+    return 1;
+}
+
+static void *trabalhadorJanela(void *arg)
+{
+    tTrabalhadorJanela *t = (tTrabalhadorJanela *)arg;
+    tJanelas *j = t->comum;
+    int passo = j->k - 1;
+    int qtd = j->n / passo; // Janelas por fase: a última no máximo encosta na ponta da primeira
+    int resto = j->n % passo;  // Inícios [qtd * passo, n), que nenhuma fase alcança
+
+    for (int passada = 0; passada < j->passadas; passada++)
+    {
+        int melhoras = 0;
+        int base = passada * (passo + resto); // Cada fase e cada janela do resto tem sua marca
+
+        for (int fase = 0; fase < passo; fase++)
+        {
+            for (int w = t->id; w < qtd; w += j->threads)
+                melhoras += resolveJanela(t, fase + w * passo, base + fase);
+
+            pthread_barrier_wait(&j->barreira);
+        }
+
+        // As janelas do resto se sobrepõem: vão em série, e a barreira abaixo espera por elas
+        if (t->id == 0)
+            for (int r = 0; r < resto; r++)
+                melhoras += resolveJanela(t, qtd * passo + r, base + passo + r);
+
+        atomic_fetch_add(&j->melhorasPassada[passada % 2], melhoras);
+        pthread_barrier_wait(&j->barreira);
+
+        int total = atomic_load(&j->melhorasPassada[passada % 2]);
+        if (t->id == 0)
+        {
+            atomic_store(&j->melhorasPassada[(passada + 1) % 2], 0);
+            j->passadasFeitas = passada + 1;
+        }
+        if (total == 0)
+            break;
+    }
+
+    return NULL;
+}
+
+double otimizaJanelas(tGrafo *grafo, int *tour, int k, int passadas, int threads)
+{
+    int n = getSizeVertices(grafo);
+
+    if (k > MAX_JANELA)
+        k = MAX_JANELA;
+    if (k > n)
+        k = n;
+    if (k < 4 || passadas < 1)
+        return comprimentoTour(grafo, tour, n);
+    if (threads < 1)
+        threads = 1;
+
+    tJanelas janelas;
+    janelas.grafo = grafo;
+    janelas.tour = tour;
+    janelas.n = n;
+    janelas.k = k;
+    janelas.passadas = passadas;
+    janelas.threads = threads;
+    janelas.passadasFeitas = 0;
+    atomic_init(&janelas.melhorasPassada[0], 0);
+    atomic_init(&janelas.melhorasPassada[1], 0);
+    janelas.mudou = (int *)malloc(n * sizeof(int));
+    janelas.resolvida = (int *)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++)
+        janelas.mudou[i] = janelas.resolvida[i] = -1;
+    pthread_barrier_init(&janelas.barreira, NULL, threads);
+
+    int m = k - 2;
+    tTrabalhadorJanela *trabalhadores = (tTrabalhadorJanela *)malloc(threads * sizeof(tTrabalhadorJanela));
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+
+    double antes = comprimentoTour(grafo, tour, n);
+    double inicioCPU = tempoCPU();
+
+    for (int t = 0; t < threads; t++)
+    {
+        trabalhadores[t].id = t;
+        trabalhadores[t].comum = &janelas;
+        trabalhadores[t].dp = (double *)malloc(((size_t)m << m) * sizeof(double));
+        trabalhadores[t].pai = (unsigned char *)malloc((size_t)m << m);
+        trabalhadores[t].melhoradas = 0;
+        pthread_create(&ids[t], NULL, trabalhadorJanela, &trabalhadores[t]);
+    }
+
+    int melhoradas = 0;
+    for (int t = 0; t < threads; t++)
+    {
+        pthread_join(ids[t], NULL);
+        melhoradas += trabalhadores[t].melhoradas;
+        free(trabalhadores[t].dp);
+        free(trabalhadores[t].pai);
+    }
+
+    double cpu = tempoCPU() - inicioCPU;
+    double depois = comprimentoTour(grafo, tour, n);
+
+    printf("Janelas de %d cidades: %d passadas, %d janelas melhoradas, ganho %.2f (%.3f%%) em %.3f s de CPU "
+           "(%.2f por s de CPU)\n",
+           k, janelas.passadasFeitas, melhoradas, antes - depois, 100 * (antes - depois) / antes, cpu,
+           cpu > 0 ? (antes - depois) / cpu : 0);
+
+    pthread_barrier_destroy(&janelas.barreira);
+    free(janelas.mudou);
+    free(janelas.resolvida);
+    free(trabalhadores);
+    free(ids);
+
+    return depois;
+}
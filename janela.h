@@ -0,0 +1,28 @@
+#ifndef JANELA_H
+#define JANELA_H
+
+#include "grafo.h"
+
+#define MAX_JANELA 16 // Maior janela aceita: a DP usa 2^(k - 2) * (k - 2) estados
+
+/**
+ * @brief Otimiza o tour trecho a trecho: cada janela de k cidades consecutivas é resolvida exatamente
+ * @details Numa janela as duas pontas ficam fixas e as k - 2 cidades do meio são reordenadas
+ * pelo caminho mais curto entre as pontas, com a DP de Held-Karp sobre subconjuntos (bitmask).
+ * As distâncias da janela são calculadas uma vez, num bloco k x k, antes da DP.
+ * Janelas que começam a k - 1 posições uma da outra só dividem as pontas, que não mudam: cada
+ * passada tem k - 1 fases (deslocamentos 0 .. k - 2) e, dentro de uma fase, as janelas são
+ * divididas entre as threads. Os n % (k - 1) inícios que sobram no fim do tour são resolvidos
+ * em série depois das fases. Para antes se uma passada não melhorar nada.
+ * Imprime o ganho, o tempo de CPU (soma das threads) e o ganho por segundo de CPU.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param tour Tour a ser melhorado (alterado no lugar)
+ * @param k Cidades por janela (limitado a 4 .. MAX_JANELA e ao tamanho do tour)
+ * @param passadas Máximo de passadas pelo tour
+ * @param threads Quantidade de threads
+ * @return Comprimento do tour
+ */
+double otimizaJanelas(tGrafo *grafo, int *tour, int k, int passadas, int threads);
+
+#endif
@@ -0,0 +1,521 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "limite.h"
+#include "UF.h"
+
+struct stLimite
+{
+    tGrafo *grafo;
+    tVizinhos *vizinhos;
+    int tam;
+    int especial; // Vértice que fica de fora da árvore e recebe duas arestas
+
+    // Grafo esparso de candidatos
+    int qtdArestas;
+    int *u;
+    int *v;
+    float *dist;
+
+    double *pi;
+    double *melhorPi;
+    int *grau;
+
+    // 1-árvore das melhores penalidades (preenchida por vizinhosAlpha)
+    int *arvore; // Índices das arestas escolhidas
+};
+
+// Par (peso, aresta) ordenado pelo qsort a cada iteração
+typedef struct
+{
+    double peso;
+    int aresta;
+} tPeso;
+
+static int compPeso(const void *p1, const void *p2)
+{
+    const tPeso *a = (const tPeso *)p1;
+    const tPeso *b = (const tPeso *)p2;
+
+    if (a->peso < b->peso)
+        return -1;
+    if (a->peso > b->peso)
+        return 1;
+    return a->aresta - b->aresta;
+}
+
+static int compPar(const void *p1, const void *p2)
+{
+    const long long *a = (const long long *)p1;
+    const long long *b = (const long long *)p2;
+
+    return (*a > *b) - (*a < *b);
+}
+
+tLimite *initLimite(tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos)
+{
+    int n = getSizeVertices(grafo);
+    int k = getQtdVizinhos(vizinhos);
+    tLimite *limite = (tLimite *)malloc(sizeof(tLimite));
+
+    limite->grafo = grafo;
+    limite->vizinhos = vizinhos;
+    limite->tam = n;
+
+    // Folha da MST: tirando ela, a MST continua conexa
+    int *grauMST = (int *)calloc(n, sizeof(int));
+    for (int i = 0; i < n - 1; i++)
+    {
+        grauMST[getV1(MST[i])]++;
+        grauMST[getV2(MST[i])]++;
+    }
+    limite->especial = 0;
+    while (grauMST[limite->especial] != 1)
+        limite->especial++;
+    free(grauMST);
+
+    // Pares (menor, maior) codificados em um long long, para ordenar e tirar repetidos
+    long long *pares = (long long *)malloc(((size_t)n * k + n) * sizeof(long long));
+    size_t qtd = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        int *lista = getVizinhos(vizinhos, i);
+        for (int j = 0; j < k; j++)
+        {
+            int a = i < lista[j] ? i : lista[j];
+            int b = i < lista[j] ? lista[j] : i;
+            pares[qtd++] = (long long)a * n + b;
+        }
+    }
+    for (int i = 0; i < n - 1; i++)
+    {
+        int a = getV1(MST[i]) < getV2(MST[i]) ? getV1(MST[i]) : getV2(MST[i]);
+        int b = getV1(MST[i]) < getV2(MST[i]) ? getV2(MST[i]) : getV1(MST[i]);
+        pares[qtd++] = (long long)a * n + b;
+    }
+
+    qsort(pares, qtd, sizeof(long long), compPar);
+
+    limite->u = (int *)malloc(qtd * sizeof(int));
+    limite->v = (int *)malloc(qtd * sizeof(int));
+    limite->dist = (float *)malloc(qtd * sizeof(float));
+    limite->qtdArestas = 0;
+
+    for (size_t p = 0; p < qtd; p++)
+    {
+        if (p > 0 && pares[p] == pares[p - 1])
+            continue;
+
+        int e = limite->qtdArestas++;
+        limite->u[e] = (int)(pares[p] / n);
+        limite->v[e] = (int)(pares[p] % n);
+        limite->dist[e] = distVertices(grafo, limite->u[e], limite->v[e]);
+    }
+    free(pares);
+
+    limite->pi = (double *)calloc(n, sizeof(double));
+    limite->melhorPi = (double *)calloc(n, sizeof(double));
+    limite->grau = (int *)malloc(n * sizeof(int));
+    limite->arvore = (int *)malloc(n * sizeof(int));
+
+    return limite;
+}
+
+void freeLimite(tLimite *limite)
+{
+    free(limite->u);
+    free(limite->v);
+    free(limite->dist);
+    free(limite->pi);
+    free(limite->melhorPi);
+    free(limite->grau);
+    free(limite->arvore);
+    free(limite);
+}
+
+/**
+ * @brief Monta a 1-árvore mínima do grafo esparso com as penalidades pi
+ * @details Kruskal sobre os vértices sem o especial, e depois as duas arestas mais leves do especial.
+ * Preenche limite->grau e limite->arvore (as n arestas escolhidas).
+ *
+ * @return Peso da 1-árvore (com as penalidades)
+ */
+static double umArvoreEsparsa(tLimite *limite, double *pi, tPeso *ordem)
+{
+    int n = limite->tam;
+    int s = limite->especial;
+    int m = limite->qtdArestas;
+
+    for (int e = 0; e < m; e++)
+    {
+        ordem[e].peso = limite->dist[e] + pi[limite->u[e]] + pi[limite->v[e]];
+        ordem[e].aresta = e;
+    }
+    qsort(ordem, m, sizeof(tPeso), compPeso);
+
+    memset(limite->grau, 0, n * sizeof(int));
+
+    tUF *F = InitUnionFind(n);
+    double peso = 0;
+    int escolhidas = 0;
+    int especiais = 0;
+
+    for (int i = 0; i < m && (escolhidas < n - 2 || especiais < 2); i++)
+    {
+        int e = ordem[i].aresta;
+        int a = limite->u[e];
+        int b = limite->v[e];
+
+        if (a == s || b == s)
+        {
+            // As duas primeiras arestas do especial na ordem já são as mais leves
+            if (especiais == 2)
+                continue;
+            especiais++;
+        }
+        else
+        {
+            if (escolhidas == n - 2 || IsConnected(F, a, b))
+                continue;
+            Union(F, a, b);
+            escolhidas++;
+        }
+
+        limite->arvore[escolhidas + especiais - 1] = e;
+        limite->grau[a]++;
+        limite->grau[b]++;
+        peso += ordem[i].peso;
+    }
+
+    freeUnionFind(F);
+
+    return peso;
+}
+
+double otimizaLimite(tLimite *limite, int iteracoes, double limiteSuperior)
+{
+    int n = limite->tam;
+    tPeso *ordem = (tPeso *)malloc(limite->qtdArestas * sizeof(tPeso));
+
+    double lambda = 2.0;
+    double melhor = -HUGE_VAL;
+    int semMelhora = 0;
+    int paciencia = iteracoes / 20 > 10 ? iteracoes / 20 : 10;
+
+    for (int it = 0; it < iteracoes; it++)
+    {
+        double somaPi = 0;
+        for (int i = 0; i < n; i++)
+            somaPi += limite->pi[i];
+
+        double valor = umArvoreEsparsa(limite, limite->pi, ordem) - 2 * somaPi;
+
+        if (valor > melhor + 1e-9)
+        {
+            melhor = valor;
+            memcpy(limite->melhorPi, limite->pi, n * sizeof(double));
+            semMelhora = 0;
+        }
+        else if (++semMelhora >= paciencia)
+        {
+            lambda /= 2;
+            semMelhora = 0;
+        }
+
+        double norma = 0;
+        for (int i = 0; i < n; i++)
+            norma += (double)(limite->grau[i] - 2) * (limite->grau[i] - 2);
+
+        // Todos com grau 2: a 1-árvore é um tour, não dá para subir mais
+        if (norma == 0 || lambda < 1e-6)
+            break;
+
+        double folga = limiteSuperior - valor;
+        if (folga <= 0)
+            folga = 1e-4 * fabs(valor);
+
+        double passo = lambda * folga / norma;
+        for (int i = 0; i < n; i++)
+            limite->pi[i] += passo * (limite->grau[i] - 2);
+    }
+
+    free(ordem);
+
+    return melhor;
+}
+
+double certificaLimite(tLimite *limite)
+{
+    int n = limite->tam;
+    int s = limite->especial;
+    double *pi = limite->melhorPi;
+
+    double *custo = (double *)malloc(n * sizeof(double));
+    char *naArvore = (char *)calloc(n, sizeof(char));
+
+    // Prim denso sobre todos os vértices menos o especial
+    int atual = s == 0 ? 1 : 0;
+    for (int i = 0; i < n; i++)
+        custo[i] = HUGE_VAL;
+    naArvore[s] = 1;
+
+    double peso = 0;
+    for (int passo = 0; passo < n - 1; passo++)
+    {
+        naArvore[atual] = 1;
+
+        int proximo = -1;
+        for (int i = 0; i < n; i++)
+        {
+            if (naArvore[i])
+                continue;
+
+            double w = distVertices(limite->grafo, atual, i) + pi[atual] + pi[i];
+            if (w < custo[i])
+                custo[i] = w;
+            if (proximo < 0 || custo[i] < custo[proximo])
+                proximo = i;
+        }
+
+        if (proximo < 0)
+            break;
+        peso += custo[proximo];
+        atual = proximo;
+    }
+
+    // Duas arestas mais leves do especial
+    double menor1 = HUGE_VAL, menor2 = HUGE_VAL;
+    for (int i = 0; i < n; i++)
+    {
+        if (i == s)
+            continue;
+
+        double w = distVertices(limite->grafo, s, i) + pi[s] + pi[i];
+        if (w < menor1)
+        {
+            menor2 = menor1;
+            menor1 = w;
+        }
+        else if (w < menor2)
+            menor2 = w;
+    }
+    peso += menor1 + menor2;
+
+    for (int i = 0; i < n; i++)
+        peso -= 2 * pi[i];
+
+    free(custo);
+    free(naArvore);
+
+    return peso;
+}
+
+// ------------------------- Alpha-nearness ------------------------- //
+
+typedef struct
+{
+    int aresta;
+    double alpha;
+    int ordem; // Posição na lista de vizinhos, para desempate
+} tCandidato;
+
+static int compCandidato(const void *p1, const void *p2)
+{
+    const tCandidato *a = (const tCandidato *)p1;
+    const tCandidato *b = (const tCandidato *)p2;
+
+    if (a->alpha < b->alpha)
+        return -1;
+    if (a->alpha > b->alpha)
+        return 1;
+    return a->ordem - b->ordem;
+}
+
+tVizinhos *vizinhosAlpha(tLimite *limite, int k)
+{
+    int n = limite->tam;
+    int s = limite->especial;
+    double *pi = limite->melhorPi;
+    int qtdLista = getQtdVizinhos(limite->vizinhos);
+
+    if (k > qtdLista)
+        k = qtdLista;
+
+    tPeso *ordem = (tPeso *)malloc(limite->qtdArestas * sizeof(tPeso));
+    umArvoreEsparsa(limite, pi, ordem);
+    free(ordem);
+
+    // Lista de adjacência da árvore (sem o especial) e o maior peso das arestas do especial
+    int *inicio = (int *)calloc(n + 1, sizeof(int));
+    int *adj = (int *)malloc(2 * n * sizeof(int));
+    double *pesoAdj = (double *)malloc(2 * n * sizeof(double));
+    double segundaEspecial = -HUGE_VAL;
+
+    for (int t = 0; t < n; t++)
+    {
+        int e = limite->arvore[t];
+        if (limite->u[e] == s || limite->v[e] == s)
+            continue;
+        inicio[limite->u[e] + 1]++;
+        inicio[limite->v[e] + 1]++;
+    }
+    for (int i = 0; i < n; i++)
+        inicio[i + 1] += inicio[i];
+
+    int *proximo = (int *)malloc(n * sizeof(int));
+    memcpy(proximo, inicio, n * sizeof(int));
+    for (int t = 0; t < n; t++)
+    {
+        int e = limite->arvore[t];
+        int a = limite->u[e], b = limite->v[e];
+        double w = limite->dist[e] + pi[a] + pi[b];
+
+        if (a == s || b == s)
+        {
+            if (w > segundaEspecial)
+                segundaEspecial = w;
+            continue;
+        }
+        adj[proximo[a]] = b;
+        pesoAdj[proximo[a]++] = w;
+        adj[proximo[b]] = a;
+        pesoAdj[proximo[b]++] = w;
+    }
+    free(proximo);
+
+    // Binary lifting: sobe[j][v] é o ancestral 2^j de v, e maximo[j][v] o maior peso no caminho
+    int niveis = 1;
+    while ((1 << niveis) < n)
+        niveis++;
+
+    int *profundidade = (int *)calloc(n, sizeof(int));
+    int *sobe = (int *)malloc((size_t)niveis * n * sizeof(int));
+    double *maximo = (double *)malloc((size_t)niveis * n * sizeof(double));
+    int *fila = (int *)malloc(n * sizeof(int));
+    char *visitado = (char *)calloc(n, sizeof(char));
+
+    int raiz = s == 0 ? 1 : 0;
+    int iniFila = 0, fimFila = 0;
+    fila[fimFila++] = raiz;
+    visitado[raiz] = 1;
+    sobe[raiz] = raiz;
+    maximo[raiz] = 0;
+
+    while (iniFila < fimFila)
+    {
+        int x = fila[iniFila++];
+        for (int p = inicio[x]; p < inicio[x + 1]; p++)
+        {
+            int y = adj[p];
+            if (visitado[y])
+                continue;
+            visitado[y] = 1;
+            profundidade[y] = profundidade[x] + 1;
+            sobe[y] = x;
+            maximo[y] = pesoAdj[p];
+            fila[fimFila++] = y;
+        }
+    }
+    sobe[s] = s;
+    maximo[s] = 0;
+
+    for (int j = 1; j < niveis; j++)
+    {
+        for (int x = 0; x < n; x++)
+        {
+            int meio = sobe[(size_t)(j - 1) * n + x];
+            sobe[(size_t)j * n + x] = sobe[(size_t)(j - 1) * n + meio];
+            double m1 = maximo[(size_t)(j - 1) * n + x];
+            double m2 = maximo[(size_t)(j - 1) * n + meio];
+            maximo[(size_t)j * n + x] = m1 > m2 ? m1 : m2;
+        }
+    }
+
+    int *lista = (int *)malloc((size_t)n * (k > 0 ? k : 1) * sizeof(int));
+    tCandidato *candidatos = (tCandidato *)malloc((qtdLista > 0 ? qtdLista : 1) * sizeof(tCandidato));
+
+    for (int i = 0; i < n; i++)
+    {
+        int *viz = getVizinhos(limite->vizinhos, i);
+
+        for (int c = 0; c < qtdLista; c++)
+        {
+            int j = viz[c];
+            double w = distVertices(limite->grafo, i, j) + pi[i] + pi[j];
+            double maior;
+
+            if (i == s || j == s)
+                maior = segundaEspecial;
+            else
+            {
+                // Maior peso no caminho da árvore entre i e j
+                int a = i, b = j;
+                maior = -HUGE_VAL;
+                if (profundidade[a] < profundidade[b])
+                {
+                    int aux = a;
+                    a = b;
+                    b = aux;
+                }
+                for (int nivel = niveis - 1; nivel >= 0; nivel--)
+                {
+                    if (profundidade[a] - (1 << nivel) >= profundidade[b])
+                    {
+                        double m = maximo[(size_t)nivel * n + a];
+                        if (m > maior)
+                            maior = m;
+                        a = sobe[(size_t)nivel * n + a];
+                    }
+                }
+                if (a != b)
+                {
+                    for (int nivel = niveis - 1; nivel >= 0; nivel--)
+                    {
+                        int pa = sobe[(size_t)nivel * n + a];
+                        int pb = sobe[(size_t)nivel * n + b];
+                        if (pa != pb)
+                        {
+                            double ma = maximo[(size_t)nivel * n + a];
+                            double mb = maximo[(size_t)nivel * n + b];
+                            if (ma > maior)
+                                maior = ma;
+                            if (mb > maior)
+                                maior = mb;
+                            a = pa;
+                            b = pb;
+                        }
+                    }
+                    if (maximo[a] > maior)
+                        maior = maximo[a];
+                    if (maximo[b] > maior)
+                        maior = maximo[b];
+                }
+            }
+
+            candidatos[c].aresta = j;
+            candidatos[c].alpha = w - maior > 0 ? w - maior : 0;
+            candidatos[c].ordem = c;
+        }
+
+        qsort(candidatos, qtdLista, sizeof(tCandidato), compCandidato);
+        for (int c = 0; c < k; c++)
+            lista[(size_t)i * k + c] = candidatos[c].aresta;
+    }
+
+    tVizinhos *alpha = initVizinhosDeVetor(lista, n, k);
+
+    free(lista);
+    free(candidatos);
+    free(inicio);
+    free(adj);
+    free(pesoAdj);
+    free(profundidade);
+    free(sobe);
+    free(maximo);
+    free(fila);
+    free(visitado);
+
+    return alpha;
+}
@@ -0,0 +1,63 @@
+#ifndef LIMITE_H
+#define LIMITE_H
+
+#include "grafo.h"
+#include "vizinhos.h"
+
+typedef struct stLimite tLimite;
+
+/**
+ * @brief Prepara o cálculo do limite inferior de Held-Karp (1-árvores)
+ * @details O grafo esparso de candidatos é a união das listas de vizinhos com as arestas da MST,
+ * o que garante que ele é conexo. O vértice especial da 1-árvore é uma folha da MST.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param vizinhos Listas de candidatos
+ * @pre Qtd_vértices >= 3
+ * @return tLimite*
+ */
+tLimite *initLimite(tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos);
+
+/**
+ * @brief Destrói a estrutura do limite
+ *
+ * @param limite Estrutura a ser liberada
+ */
+void freeLimite(tLimite *limite);
+
+/**
+ * @brief Otimização por subgradiente das penalidades (pi) dos vértices
+ * @details Cada iteração monta a 1-árvore mínima no grafo de candidatos com Kruskal + UF, usando
+ * os pesos dist(i,j) + pi[i] + pi[j], e empurra pi na direção de (grau - 2). O passo é o de
+ * Polyak, em função do limite superior.
+ *
+ * @param limite Estrutura do limite
+ * @param iteracoes Máximo de iterações
+ * @param limiteSuperior Comprimento de um tour conhecido
+ * @return Melhor valor no grafo esparso (estimativa, ainda não certificada)
+ */
+double otimizaLimite(tLimite *limite, int iteracoes, double limiteSuperior);
+
+/**
+ * @brief Recalcula a 1-árvore das melhores penalidades no grafo completo
+ * @details Usa Prim denso, O(n²) em tempo e O(n) em memória. Como a 1-árvore do grafo completo
+ * é mínima de verdade, o valor retornado é um limite inferior válido para qualquer tour.
+ *
+ * @param limite Estrutura do limite
+ * @return double
+ */
+double certificaLimite(tLimite *limite);
+
+/**
+ * @brief Monta listas de candidatos ordenadas por alpha-nearness
+ * @details alpha(i,j) é quanto a 1-árvore mínima (com as melhores penalidades) aumenta se (i,j)
+ * for obrigada a entrar nela. Os candidatos avaliados são os das listas de vizinhos do initLimite.
+ *
+ * @param limite Estrutura do limite
+ * @param k Quantidade de candidatos por vértice (é limitado ao tamanho das listas de vizinhos)
+ * @return tVizinhos*
+ */
+tVizinhos *vizinhosAlpha(tLimite *limite, int k);
+
+#endif
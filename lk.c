@@ -0,0 +1,327 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lk.h"
+#include "tempo.h"
+#include "tour.h"
+#include "aleatorio.h"
+
+#define PROFUNDIDADE_LK 50 // Máximo de passos (3-opt sequenciais) numa cadeia
+#define LARGURA_LK 5       // Alternativas tentadas no primeiro nível (metade no segundo, depois 1)
+#define EPSILON_LK 1e-4    // Ganho mínimo para aceitar uma cadeia ou uma perturbação
+
+// Um passo candidato da cadeia; t5 < 0 quando o passo é um 2-opt
+typedef struct
+{
+    int t3, t4, t5, t6;
+    int t6Depois; // t6 depois de t5: troca de trechos sem inversão
+    double ganho; // Ganho acumulado sem a aresta que fecha o tour
+} tPasso;
+
+typedef struct
+{
+    tGrafo *grafo;
+    tVizinhos *vizinhos;
+    tTour *tour; // Com o registro de trocas ligado
+    int candidatos;
+
+    // Arestas que entraram na cadeia atual: não podem sair de novo
+    int colocadas[2 * PROFUNDIDADE_LK][2];
+    int qtdColocadas;
+
+    double melhorGanho; // Melhor fechamento da cadeia atual
+    int melhorMarca;    // Marca do registro nesse fechamento (-1: nenhum com ganho)
+
+    double comprimento;
+    int esgotou;
+} tLK;
+
+// Próxima e anterior no sentido s (1: o do vetor, -1: o contrário)
+static int proxima(tLK *lk, int cidade, int s)
+{
+    return s > 0 ? sucessorTour(lk->tour, cidade) : antecessorTour(lk->tour, cidade);
+}
+
+static int anterior(tLK *lk, int cidade, int s)
+{
+    return s > 0 ? antecessorTour(lk->tour, cidade) : sucessorTour(lk->tour, cidade);
+}
+
+static int colocada(tLK *lk, int x, int y)
+{
+    for (int i = 0; i < lk->qtdColocadas; i++)
+        if ((lk->colocadas[i][0] == x && lk->colocadas[i][1] == y) ||
+            (lk->colocadas[i][0] == y && lk->colocadas[i][1] == x))
+            return 1;
+    return 0;
+}
+
+static void coloca(tLK *lk, int x, int y)
+{
+    lk->colocadas[lk->qtdColocadas][0] = x;
+    lk->colocadas[lk->qtdColocadas][1] = y;
+    lk->qtdColocadas++;
+}
+
+// Guarda o passo entre os qtd melhores (ordenados pelo ganho, do maior para o menor)
+static void inserePasso(tPasso *passos, int *qtd, int capacidade, tPasso passo)
+{
+    int i = *qtd < capacidade ? (*qtd)++ : capacidade;
+    while (i > 0 && passos[i - 1].ganho < passo.ganho)
+    {
+        if (i < capacidade)
+            passos[i] = passos[i - 1];
+        i--;
+    }
+    if (i < capacidade)
+        passos[i] = passo;
+}
+
+/**
+ * @brief Estende a cadeia a partir da aresta aberta (t1, t2), com t2 logo depois de t1
+ * @details ganho é o que a cadeia ganhou até aqui sem contar a aresta (t1, t2), que fecharia
+ * o tour. Cada fechamento melhor que o anterior fica marcado em melhorGanho/melhorMarca.
+ */
+static void aprofunda(tLK *lk, int t1, int t2, double ganho, int nivel)
+{
+    if (nivel >= PROFUNDIDADE_LK)
+        return;
+
+    tGrafo *grafo = lk->grafo;
+    tTour *tour = lk->tour;
+    int s = sucessorTour(tour, t1) == t2 ? 1 : -1;
+    int amplitude = nivel < 2 ? LARGURA_LK >> nivel : 1;
+
+    tPasso passos[LARGURA_LK];
+    int qtd = 0;
+
+    int *lista2 = getVizinhos(lk->vizinhos, t2);
+    for (int v = 0; v < lk->candidatos; v++)
+    {
+        int t3 = lista2[v];
+        double g1 = ganho - distVertices(grafo, t2, t3);
+
+        // Lista ordenada: daqui em diante o ganho parcial não é mais positivo
+        if (g1 <= 0)
+            break;
+        if (t3 == t1 || t3 == proxima(lk, t2, s))
+            continue;
+
+        // t4 antes de t3: fechar com (t4, t1) é um 2-opt
+        int t4 = anterior(lk, t3, s);
+        if (!colocada(lk, t3, t4))
+            inserePasso(passos, &qtd, amplitude, (tPasso){t3, t4, -1, -1, 0, g1 + distVertices(grafo, t3, t4)});
+
+        // t4 depois de t3: sobra um ciclo t2 .. t3, quebrado em (t5, t6)
+        t4 = proxima(lk, t3, s);
+        if (t4 == t1 || colocada(lk, t3, t4))
+            continue;
+
+        double gB = g1 + distVertices(grafo, t3, t4);
+        tPasso melhor = {t3, t4, -1, -1, 0, 0};
+        int *lista4 = getVizinhos(lk->vizinhos, t4);
+
+        for (int w = 0; w < lk->candidatos; w++)
+        {
+            int t5 = lista4[w];
+            double g2 = gB - distVertices(grafo, t4, t5);
+
+            if (g2 <= 0)
+                break;
+            if (!(s > 0 ? entreTour(tour, t2, t5, t3) : entreTour(tour, t3, t5, t2)))
+                continue;
+
+            for (int depois = 0; depois < 2; depois++)
+            {
+                if ((depois && t5 == t3) || (!depois && t5 == t2))
+                    continue;
+
+                int t6 = depois ? proxima(lk, t5, s) : anterior(lk, t5, s);
+                double g = g2 + distVertices(grafo, t5, t6);
+                if (g > melhor.ganho && !colocada(lk, t5, t6))
+                {
+                    melhor.t5 = t5;
+                    melhor.t6 = t6;
+                    melhor.t6Depois = depois;
+                    melhor.ganho = g;
+                }
+            }
+        }
+
+        if (melhor.t5 >= 0)
+            inserePasso(passos, &qtd, amplitude, melhor);
+    }
+
+    for (int i = 0; i < qtd; i++)
+    {
+        tPasso *p = &passos[i];
+        int marca = getMarcaTour(tour);
+        int marcaColocadas = lk->qtdColocadas;
+        int fim;
+
+        if (p->t5 < 0)
+        {
+            // t1 [t2 .. t4] t3 -> t1 [t4 .. t2] t3
+            trocaTour(tour, t1, t2, p->t4, p->t3);
+            coloca(lk, t2, p->t3);
+            fim = p->t4;
+        }
+        else if (p->t6Depois)
+        {
+            // t1 [t2 .. t5] [t6 .. t3] t4 -> t1 [t6 .. t3] [t2 .. t5] t4
+            trocaTour(tour, t1, t2, p->t3, p->t4);
+            trocaTour(tour, t1, p->t3, p->t6, p->t5);
+            trocaTour(tour, p->t3, p->t5, t2, p->t4);
+            coloca(lk, t2, p->t3);
+            coloca(lk, p->t4, p->t5);
+            fim = p->t6;
+        }
+        else
+        {
+            // t1 [t2 .. t6] [t5 .. t3] t4 -> t1 [t6 .. t2] [t3 .. t5] t4
+            trocaTour(tour, t1, t2, p->t6, p->t5);
+            trocaTour(tour, t2, p->t5, p->t3, p->t4);
+            coloca(lk, t2, p->t3);
+            coloca(lk, p->t4, p->t5);
+            fim = p->t6;
+        }
+
+        double fechamento = p->ganho - distVertices(grafo, fim, t1);
+        if (fechamento > lk->melhorGanho)
+        {
+            lk->melhorGanho = fechamento;
+            lk->melhorMarca = getMarcaTour(tour);
+        }
+
+        aprofunda(lk, t1, fim, p->ganho, nivel + 1);
+
+        // Achou melhora: o chamador corta a cadeia no melhor fechamento
+        if (lk->melhorMarca >= 0)
+            return;
+
+        desfazTrocasTour(tour, marca);
+        lk->qtdColocadas = marcaColocadas;
+    }
+}
+
+// Tenta uma cadeia a partir de cada aresta de t1; retorna 1 se o tour melhorou
+static int melhoraCidade(tLK *lk, int t1)
+{
+    for (int direcao = 0; direcao < 2; direcao++)
+    {
+        int t2 = direcao == 0 ? sucessorTour(lk->tour, t1) : antecessorTour(lk->tour, t1);
+        int marca = getMarcaTour(lk->tour);
+
+        lk->melhorGanho = EPSILON_LK;
+        lk->melhorMarca = -1;
+        lk->qtdColocadas = 0;
+
+        aprofunda(lk, t1, t2, distVertices(lk->grafo, t1, t2), 0);
+
+        if (lk->melhorMarca < 0)
+            continue;
+
+        desfazTrocasTour(lk->tour, lk->melhorMarca);
+        ativaTrocasTour(lk->tour, marca);
+        lk->comprimento -= lk->melhorGanho;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Busca local até esvaziar a fila de cidades ativas (ou o tempo acabar)
+static void desce(tLK *lk, double limite)
+{
+    int contador = 0;
+    int t1;
+
+    while ((t1 = retiraCidadeAtivaTour(lk->tour)) >= 0)
+    {
+        if (melhoraCidade(lk, t1))
+            ativaCidadeTour(lk->tour, t1);
+
+        if (++contador % 64 == 0 && agora() > limite)
+        {
+            lk->esgotou = 1;
+            return;
+        }
+    }
+}
+
+static void imprimeGap(const char *rotulo, double comprimento, double otimo)
+{
+    if (otimo > 0)
+        printf("%s: %.2f (gap %.3f%%)\n", rotulo, comprimento, 100 * (comprimento - otimo) / otimo);
+    else
+        printf("%s: %.2f\n", rotulo, comprimento);
+}
+
+double linKernighan(tGrafo *grafo, tVizinhos *vizinhos, int *tour, int candidatos, int iteracoes, double segundos,
+                    unsigned long long semente, double otimo)
+{
+    int n = getSizeVertices(grafo);
+    double antes = comprimentoTour(grafo, tour, n);
+
+    if (n < 8)
+        return antes;
+
+    tLK lk;
+    memset(&lk, 0, sizeof(tLK));
+    lk.grafo = grafo;
+    lk.vizinhos = vizinhos;
+    lk.candidatos = candidatos < getQtdVizinhos(vizinhos) ? candidatos : getQtdVizinhos(vizinhos);
+    if (lk.candidatos < 1)
+        lk.candidatos = 1;
+    lk.tour = initTour(n);
+    setCidadesTour(lk.tour, tour);
+    registraTrocasTour(lk.tour, 1);
+    lk.comprimento = antes;
+
+    double inicio = agora();
+    double limite = inicio + segundos;
+
+    desce(&lk, limite);
+    registraTrocasTour(lk.tour, 1);
+
+    double descida = lk.comprimento;
+    double tempoDescida = agora() - inicio;
+
+    // Iterated LK: cada rodada é desfeita inteira (pelo registro) se não encurtar o tour
+    tAleatorio *aleatorio = initAleatorio(semente);
+    int rodadas = 0, aceitas = 0;
+
+    while (rodadas < iteracoes && !lk.esgotou && agora() < limite)
+    {
+        double anterior = lk.comprimento;
+
+        lk.comprimento += doubleBridge(grafo, lk.tour, aleatorio);
+        desce(&lk, limite);
+        rodadas++;
+
+        if (lk.comprimento < anterior - EPSILON_LK)
+            aceitas++;
+        else
+        {
+            desfazTrocasTour(lk.tour, 0);
+            desativaCidadesTour(lk.tour);
+            lk.comprimento = anterior;
+        }
+        registraTrocasTour(lk.tour, 1);
+    }
+
+    memcpy(tour, getCidadesTour(lk.tour), n * sizeof(int));
+    double depois = comprimentoTour(grafo, tour, n);
+
+    imprimeGap("LK: tour inicial", antes, otimo);
+    printf("LK: primeira descida em %.3f s (%d candidatos, profundidade %d)\n", tempoDescida, lk.candidatos,
+           PROFUNDIDADE_LK);
+    imprimeGap("LK: ótimo local", descida, otimo);
+    printf("LK: %d perturbações (%d aceitas) em %.3f s\n", rodadas, aceitas, agora() - inicio);
+    imprimeGap("LK: final", depois, otimo);
+
+    freeAleatorio(aleatorio);
+    freeTour(lk.tour);
+
+    return depois;
+}
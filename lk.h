@@ -0,0 +1,34 @@
+#ifndef LK_H
+#define LK_H
+
+#include "grafo.h"
+#include "vizinhos.h"
+
+/**
+ * @brief Busca local de Lin-Kernighan (profundidade variável) sobre as listas de candidatos
+ * @details O tour fica num vetor com a posição de cada cidade, então sucessor, antecessor e
+ * between (b está no caminho de a até c) custam O(1); cada troca inverte o lado mais curto.
+ * Partindo de t1 e da aresta (t1, t2), cada passo é um movimento 3-opt sequencial: sai a aresta
+ * aberta, entra (t2, t3) com t3 entre os candidatos de t2, e o tour é fechado ou por um 2-opt
+ * (t4 antes de t3) ou, com t4 depois de t3, por uma segunda troca (t5, t6) com t5 entre t2 e t3.
+ * As alternativas de cada nível são ordenadas pelo ganho até o passo seguinte; a busca volta
+ * atrás só nos primeiros níveis (amplitude limitada) e vai até PROFUNDIDADE_LK passos, sem
+ * desfazer arestas que ela mesma colocou. Fica a melhor cadeia encontrada.
+ * Depois do primeiro ótimo local, enquanto houver orçamento, aplica perturbações double-bridge
+ * curtas e desfaz a rodada inteira (pelo registro de trocas) se o tour não melhorar.
+ * Imprime o comprimento antes e depois, o tempo, e o gap para otimo (se otimo > 0).
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param vizinhos Listas de candidatos
+ * @param tour Tour inicial, melhorado no lugar
+ * @param candidatos Candidatos usados por cidade (limitado ao tamanho das listas)
+ * @param iteracoes Máximo de perturbações depois do primeiro ótimo local
+ * @param segundos Tempo limite (inclusive para a primeira descida)
+ * @param semente Semente das perturbações
+ * @param otimo Comprimento de referência (ex.: de exemplos/opt), ou 0 se não houver
+ * @return Comprimento do tour
+ */
+double linKernighan(tGrafo *grafo, tVizinhos *vizinhos, int *tour, int candidatos, int iteracoes, double segundos,
+                    unsigned long long semente, double otimo);
+
+#endif
@@ -4,6 +4,27 @@
 #include <math.h>
 #include "grafo.h"
 #include "UF.h"
+#include "tour.h"
+#include "vizinhos.h"
+#include "multistart.h"
+#include "limite.h"
+#include "cache.h"
+#include "dinamico.h"
+#include "particao.h"
+#include "desenho.h"
+#include "saida.h"
+#include "gerador.h"
+#include "escala.h"
+#include "hilbert.h"
+#include "genetico.h"
+#include "christofides.h"
+#include "entrada.h"
+#include "pequenas.h"
+#include "janela.h"
+#include "lk.h"
+#include "tempo.h"
+
+#define DIRETORIO_CACHE "exemplos/cache"
 
 void readFileHeader(FILE *arq, tGrafo *grafo, char *name, int *dimension);
 
@@ -15,108 +36,596 @@ static void imprimeVetor(int *vetor, int N, FILE *fOut)
     }
 }
 
-// Insere um elemento se ele ainda não estiver no vetor
-static int insereVetor(int *vetor, int N, int elem, int pos)
+static void inverteVetor(int *vetor, int N)
+{
+    int aux;
+    for (int i = 0; i < N / 2; i++)
+    {
+        aux = vetor[i];
+        vetor[i] = vetor[N - 1 - i];
+        vetor[N - 1 - i] = aux;
+    }
+}
+
+static void imprimeUso(char *prog)
 {
-    for (int i = 0; i < pos; i++)
+    printf("Uso: %s [exemplo] [opções]\n", prog);
+    printf("  exemplo          nome em exemplos/in (padrão: pr1002), ou - para ler TSPLIB/\"id x y\" do stdin\n");
+    printf("  --partidas N     melhora o tour com N partidas aleatórias (multi-start)\n");
+    printf("  --threads T      threads do multi-start, da partição, do --ag, do --janela e do --pequenas (padrão: 1)\n");
+    printf("  --chutes K       perturbações double-bridge por partida (padrão: 0)\n");
+    printf("  --semente S      semente do multi-start (padrão: 1)\n");
+    printf("  --limite N       limite inferior de Held-Karp com N iterações de subgradiente\n");
+    printf("  --alpha K        com --limite, salva K candidatos alpha-nearness por vértice em .cand\n");
+    printf("  --cache          reaproveita MST e candidatos de %s (grava se não houver)\n", DIRETORIO_CACHE);
+    printf("  --dinamico ARQ   aplica as operações de ARQ (+ x y | - id | m id x y) e salva em *_din\n");
+    printf("  --particao P     resolve por partição geométrica em células de até P vértices (instâncias grandes)\n");
+    printf("  --desenho ARQ    desenha cidades, MST e tour em ARQ (.png, .ppm ou .svg)\n");
+    printf("  --largura L      largura do desenho em pixels (padrão: 1024)\n");
+    printf("  --referencia     sobrepõe ao desenho o tour de exemplos/opt\n");
+    printf("  --binario        também grava MST e tour no formato binário (.mstb e .tourb)\n");
+    printf("  --decodifica ARQ imprime a seção de um .tourb ou .mstb como no .tour/.mst e sai\n");
+    printf("  --gera D N       gera exemplos/in/<D><N>_<semente>.tsp (D: uniforme, agrupada ou grade) e sai\n");
+    printf("  --escala D N     mede tempo e memória de cada fase em instâncias D de 1000 a N vértices e sai\n");
+    printf("  --pequenas Q     resolve Q instâncias aleatórias de 5 a 60 vértices em lote (SIMD) e sai\n");
+    printf("  --ag S           algoritmo genético em ilhas (uma por thread, --threads) por até S segundos\n");
+    printf("  --populacao N    indivíduos por ilha do --ag (padrão: 100)\n");
+    printf("  --migracao G     gerações entre migrações do --ag (padrão: 10)\n");
+    printf("  --lk S           Lin-Kernighan com perturbações (iterated LK) por até S segundos\n");
+    printf("  --iteracoes-lk N  máximo de perturbações do --lk (padrão: Qtd_vértices)\n");
+    printf("  --candidatos-lk C  candidatos por cidade no --lk (padrão: 6)\n");
+    printf("  --janela K       reotimiza o tour com DP exata em janelas de K cidades consecutivas (K <= %d)\n", MAX_JANELA);
+    printf("  --passadas-janela P  máximo de passadas do --janela (padrão: 3)\n");
+    printf("  --christofides   gera o tour inicial por Christofides em vez do caminhamento na MST\n");
+    printf("  --emparelhamento N  com --christofides, máximo de vértices ímpares no emparelhamento exato (padrão: 1000)\n");
+    printf("  --hilbert        renumera os vértices pela curva de Hilbert (as saídas usam os ids originais; vale no --escala)\n");
+    printf("  --denso N        maior n para as fases com vetor de arestas no --escala, no --christofides e no stdin (padrão: 10000)\n");
+}
+
+/**
+ * @brief Aplica as operações de inserção, remoção e movimento sobre a solução pronta
+ * @details Os ids do arquivo de operações começam em 1, como no .tsp; vértices inseridos
+ * recebem os ids seguintes. A instância final é renumerada e salva em exemplos/out/<nome>_din.*
+ */
+static void executaDinamico(tGrafo *grafo, tAresta **MST, int *tour, char *arquivoOps, char *name)
+{
+    FILE *fOps = fopen(arquivoOps, "r");
+    if (!fOps)
+    {
+        printf("Não foi possível abrir %s\n", arquivoOps);
+        return;
+    }
+
+    tDinamico *dinamico = initDinamico(grafo, MST, tour);
+    int qtdOps = 0;
+    char op;
+    int id;
+    float x, y;
+
+    double inicio = agora();
+    while (fscanf(fOps, " %c", &op) == 1)
+    {
+        if (op == '+' && fscanf(fOps, "%f %f", &x, &y) == 2)
+            insereVerticeDinamico(dinamico, x, y);
+        else if (op == '-' && fscanf(fOps, "%d", &id) == 1)
+            removeVerticeDinamico(dinamico, id - 1);
+        else if (op == 'm' && fscanf(fOps, "%d %f %f", &id, &x, &y) == 3)
+            moveVerticeDinamico(dinamico, id - 1, x, y);
+        else
+            break;
+        qtdOps++;
+    }
+    double tempo = agora() - inicio;
+    fclose(fOps);
+
+    int qtd = getQtdAtivosDinamico(dinamico);
+    int qtdIds = getQtdIdsDinamico(dinamico);
+    int *novoId = (int *)malloc(qtdIds * sizeof(int));
+    int *pares = (int *)malloc(2 * (qtd > 1 ? qtd : 1) * sizeof(int));
+    int *tourDin = (int *)malloc((qtd > 0 ? qtd : 1) * sizeof(int));
+
+    printf("Operações dinâmicas: %d (%.1f us por operação)\n", qtdOps, qtdOps ? 1e6 * tempo / qtdOps : 0);
+    printf("Peso da MST (incremental): %.2f\n", getPesoMSTDinamico(dinamico));
+    printf("Peso da MST (recalculado): %.2f\n", pesoMSTExatoDinamico(dinamico));
+    printf("Comprimento do tour (dinâmico): %.2f\n", getTourDinamico(dinamico, tourDin));
+
+    char path[128];
+    snprintf(path, sizeof(path), "exemplos/out/%s_din.tsp", name);
+    tSaida *sTsp = initSaida(path);
+    snprintf(path, sizeof(path), "exemplos/out/%s_din.mst", name);
+    tSaida *sMST = initSaida(path);
+    snprintf(path, sizeof(path), "exemplos/out/%s_din.tour", name);
+    tSaida *sTour = initSaida(path);
+
+    if (sTsp && sMST && sTour)
     {
-        if (vetor[i] == elem)
+        escreveTextoSaida(sTsp, "NAME: ");
+        escreveTextoSaida(sTsp, name);
+        escreveTextoSaida(sTsp, "_din\nCOMMENT: ");
+        escreveTextoSaida(sTsp, name);
+        escreveTextoSaida(sTsp, " depois de ");
+        escreveInteiroSaida(sTsp, qtdOps);
+        escreveTextoSaida(sTsp, " operações\nTYPE: TSP\nDIMENSION: ");
+        escreveInteiroSaida(sTsp, qtd);
+        escreveTextoSaida(sTsp, "\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n");
+
+        // Ids ativos renumerados de forma compacta, na ordem original
+        for (int i = 0, j = 0; i < qtdIds; i++)
         {
-            return 0;
+            novoId[i] = -1;
+            if (getVerticeDinamico(dinamico, i, &x, &y))
+            {
+                novoId[i] = j++;
+                escreveInteiroSaida(sTsp, j);
+                escreveCharSaida(sTsp, ' ');
+                escreveRealSaida(sTsp, x);
+                escreveCharSaida(sTsp, ' ');
+                escreveRealSaida(sTsp, y);
+                escreveCharSaida(sTsp, '\n');
+            }
+        }
+        escreveTextoSaida(sTsp, "EOF\n");
+
+        escreveTextoSaida(sMST, "NAME: ");
+        escreveTextoSaida(sMST, name);
+        escreveTextoSaida(sMST, "_din\nTYPE: MST\nDIMENSION: ");
+        escreveInteiroSaida(sMST, qtd);
+        escreveTextoSaida(sMST, "\nMST_SECTION\n");
+        int qtdArestas = getArestasMSTDinamico(dinamico, pares);
+        for (int i = 0; i < qtdArestas; i++)
+        {
+            escreveInteiroSaida(sMST, novoId[pares[2 * i]] + 1);
+            escreveCharSaida(sMST, ' ');
+            escreveInteiroSaida(sMST, novoId[pares[2 * i + 1]] + 1);
+            escreveCharSaida(sMST, '\n');
+        }
+        escreveTextoSaida(sMST, "EOF\n");
+
+        escreveTextoSaida(sTour, "NAME: ");
+        escreveTextoSaida(sTour, name);
+        escreveTextoSaida(sTour, "_din\nTYPE: TOUR\nDIMENSION: ");
+        escreveInteiroSaida(sTour, qtd);
+        escreveTextoSaida(sTour, "\nTOUR_SECTION\n");
+        for (int i = 0; i < qtd; i++)
+        {
+            escreveInteiroSaida(sTour, novoId[tourDin[i]] + 1);
+            escreveCharSaida(sTour, '\n');
         }
+        escreveTextoSaida(sTour, "EOF\n");
+    }
+
+    if (sTsp)
+        fechaSaida(sTsp);
+    if (sMST)
+        fechaSaida(sMST);
+    if (sTour)
+        fechaSaida(sTour);
+
+    free(novoId);
+    free(pares);
+    free(tourDin);
+    freeDinamico(dinamico);
+}
+
+/**
+ * @brief Desenha a solução (e, se referencia != NULL, o tour de exemplos/opt/<referencia>.opt.tour)
+ */
+static void executaDesenho(tGrafo *grafo, tAresta **MST, int *tour, char *arquivo, int largura, char *referencia)
+{
+    int tam = getSizeVertices(grafo);
+    int *tourReferencia = NULL;
+
+    double inicio = agora();
+    tDesenho *desenho = initDesenho(grafo, largura);
+    setMSTDesenho(desenho, MST, tam - 1);
+    setTourDesenho(desenho, tour, tam);
+
+    if (referencia)
+    {
+        char path[128];
+        snprintf(path, sizeof(path), "exemplos/opt/%s.opt.tour", referencia);
+        tourReferencia = leTour(path, tam);
+
+        if (tourReferencia)
+            setReferenciaDesenho(desenho, tourReferencia, tam);
+        else
+            printf("Tour de referência %s não encontrado\n", path);
+    }
+
+    if (salvaDesenho(desenho, arquivo))
+        printf("Desenho salvo em %s (%.3f s)\n", arquivo, agora() - inicio);
+    else
+        printf("Não foi possível salvar o desenho em %s\n", arquivo);
+
+    free(tourReferencia);
+    freeDesenho(desenho);
+}
+
+/**
+ * @brief Decodifica um .tourb ou .mstb e imprime a seção como no .tour/.mst (índices a partir de 1)
+ * @return int 1 se o arquivo era válido
+ */
+static int executaDecodifica(char *arquivo)
+{
+    int qtd;
+    int *tour = leTourBinario(arquivo, &qtd);
+
+    if (tour)
+    {
+        for (int i = 0; i < qtd; i++)
+            printf("%d\n", tour[i] + 1);
+        free(tour);
+        return 1;
     }
-    vetor[pos] = elem;
+
+    int *pares = leMSTBinario(arquivo, &qtd);
+    if (!pares)
+        return 0;
+
+    for (int i = 0; i < qtd; i++)
+        printf("%d %d\n", pares[2 * i] + 1, pares[2 * i + 1] + 1);
+    free(pares);
+
     return 1;
 }
 
-static void inverteVetor(int *vetor, int N)
+// Salva as listas de candidatos no formato "vértice: candidatos", índices a partir de 1
+// Com ordem != NULL os vértices estão renumerados (novo i == original ordem[i])
+static void escreveCandidatos(tVizinhos *vizinhos, char *name, int tam, int *ordem)
 {
-    int aux;
-    for (int i = 0; i < N / 2; i++)
+    char path[128];
+    snprintf(path, sizeof(path), "exemplos/out/%s.cand", name);
+    tSaida *sCand = initSaida(path);
+
+    if (!sCand)
+        return;
+
+    int k = getQtdVizinhos(vizinhos);
+    escreveTextoSaida(sCand, "NAME: ");
+    escreveTextoSaida(sCand, name);
+    escreveTextoSaida(sCand, "\nTYPE: CANDIDATES\nDIMENSION: ");
+    escreveInteiroSaida(sCand, tam);
+    escreveTextoSaida(sCand, "\nCANDIDATES: ");
+    escreveInteiroSaida(sCand, k);
+    escreveTextoSaida(sCand, "\nCANDIDATE_SECTION\n");
+
+    int *novoId = (int *)malloc((tam > 0 ? tam : 1) * sizeof(int));
+    for (int i = 0; i < tam; i++)
+        novoId[ordem ? ordem[i] : i] = i;
+
+    for (int i = 0; i < tam; i++)
     {
-        aux = vetor[i];
-        vetor[i] = vetor[N - 1 - i];
-        vetor[N - 1 - i] = aux;
+        int *lista = getVizinhos(vizinhos, novoId[i]);
+        escreveInteiroSaida(sCand, i + 1);
+        for (int j = 0; j < k; j++)
+        {
+            escreveCharSaida(sCand, ' ');
+            escreveInteiroSaida(sCand, (ordem ? ordem[lista[j]] : lista[j]) + 1);
+        }
+        escreveCharSaida(sCand, '\n');
     }
+    free(novoId);
+
+    escreveTextoSaida(sCand, "EOF\n");
+    fechaSaida(sCand);
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     char name[50];
+    char metrica[50] = "EUC_2D";
     int dimension = 0;
-    char path[] = "exemplos/in/";
-    char example_name[] = "pr1002";
-    strcat(strcat(path, example_name), ".tsp");
+    char example_name[50] = "pr1002";
+
+    int partidas = 0;
+    int threads = 1;
+    int chutes = 0;
+    unsigned long long semente = 1;
+    int iteracoesLimite = 0;
+    int candidatosAlpha = 0;
+    int usaCache = 0;
+    char *arquivoDinamico = NULL;
+    int tamParticao = 0;
+    char *arquivoDesenho = NULL;
+    int larguraDesenho = 1024;
+    int usaReferencia = 0;
+    int usaBinario = 0;
+    char *arquivoDecodifica = NULL;
+    int distribuicao = -1;
+    int tamGerado = 0;
+    int geraEscala = 0;
+    int limiteDenso = 10000;
+    int usaHilbert = 0;
+    double segundosAG = 0;
+    int populacaoAG = 100;
+    int migracaoAG = 10;
+    int usaChristofides = 0;
+    int limiteEmparelhamento = 1000;
+    int qtdPequenas = 0;
+    int tamJanela = 0;
+    double segundosLK = 0;
+    int iteracoesLK = -1;
+    int candidatosLK = 6;
+    int passadasJanela = 3;
+
+    for (int a = 1; a < argc; a++)
+    {
+        if (!strcmp(argv[a], "--partidas") && a + 1 < argc)
+            partidas = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--threads") && a + 1 < argc)
+            threads = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--chutes") && a + 1 < argc)
+            chutes = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--semente") && a + 1 < argc)
+            semente = strtoull(argv[++a], NULL, 10);
+        else if (!strcmp(argv[a], "--limite") && a + 1 < argc)
+            iteracoesLimite = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--alpha") && a + 1 < argc)
+            candidatosAlpha = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--cache"))
+            usaCache = 1;
+        else if (!strcmp(argv[a], "--dinamico") && a + 1 < argc)
+            arquivoDinamico = argv[++a];
+        else if (!strcmp(argv[a], "--particao") && a + 1 < argc)
+            tamParticao = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--desenho") && a + 1 < argc)
+            arquivoDesenho = argv[++a];
+        else if (!strcmp(argv[a], "--largura") && a + 1 < argc)
+            larguraDesenho = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--referencia"))
+            usaReferencia = 1;
+        else if (!strcmp(argv[a], "--binario"))
+            usaBinario = 1;
+        else if (!strcmp(argv[a], "--decodifica") && a + 1 < argc)
+            arquivoDecodifica = argv[++a];
+        else if ((!strcmp(argv[a], "--gera") || !strcmp(argv[a], "--escala")) && a + 2 < argc)
+        {
+            geraEscala = !strcmp(argv[a], "--escala");
+            distribuicao = codigoDistribuicao(argv[a + 1]);
+            tamGerado = atoi(argv[a + 2]);
+            a += 2;
+
+            if (distribuicao < 0 || tamGerado < 1)
+            {
+                imprimeUso(argv[0]);
+                exit(4);
+            }
+        }
+        else if (!strcmp(argv[a], "--ag") && a + 1 < argc)
+            segundosAG = atof(argv[++a]);
+        else if (!strcmp(argv[a], "--populacao") && a + 1 < argc)
+            populacaoAG = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--migracao") && a + 1 < argc)
+            migracaoAG = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--pequenas") && a + 1 < argc)
+            qtdPequenas = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--lk") && a + 1 < argc)
+            segundosLK = atof(argv[++a]);
+        else if (!strcmp(argv[a], "--iteracoes-lk") && a + 1 < argc)
+            iteracoesLK = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--candidatos-lk") && a + 1 < argc)
+            candidatosLK = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--janela") && a + 1 < argc)
+            tamJanela = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--passadas-janela") && a + 1 < argc)
+            passadasJanela = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--christofides"))
+            usaChristofides = 1;
+        else if (!strcmp(argv[a], "--emparelhamento") && a + 1 < argc)
+            limiteEmparelhamento = atoi(argv[++a]);
+        else if (!strcmp(argv[a], "--hilbert"))
+            usaHilbert = 1;
+        else if (!strcmp(argv[a], "--denso") && a + 1 < argc)
+            limiteDenso = atoi(argv[++a]);
+        else if (argv[a][0] != '-' || !strcmp(argv[a], "-"))
+            snprintf(example_name, sizeof(example_name), "%s", argv[a]);
+        else
+        {
+            imprimeUso(argv[0]);
+            exit(4);
+        }
+    }
+
+    if (threads < 1)
+        threads = 1;
+    if (populacaoAG < 2)
+        populacaoAG = 2;
+
+    char path[128];
+
+    // Modos que não leem instância
+    if (arquivoDecodifica)
+    {
+        if (!executaDecodifica(arquivoDecodifica))
+            exit(3);
+        return 0;
+    }
+    if (distribuicao >= 0 && geraEscala)
+    {
+        snprintf(path, sizeof(path), "exemplos/out/escala_%s%s.csv", nomeDistribuicao(distribuicao),
+                 usaHilbert ? "_hilbert" : "");
+        executaEscala(distribuicao, tamGerado, semente, limiteDenso, usaHilbert, path);
+        return 0;
+    }
+    if (qtdPequenas > 0)
+    {
+        executaPequenas(qtdPequenas, threads, semente);
+        return 0;
+    }
+    if (distribuicao >= 0)
+    {
+        char nome[64], comentario[128];
+        snprintf(nome, sizeof(nome), "%s%d_%llu", nomeDistribuicao(distribuicao), tamGerado, semente);
+        snprintf(comentario, sizeof(comentario), "Instancia sintetica (%s, semente %llu)", nomeDistribuicao(distribuicao), semente);
+        snprintf(path, sizeof(path), "exemplos/in/%s.tsp", nome);
+
+        tGrafo *gerado = geraInstancia(distribuicao, tamGerado, semente);
+        if (!salvaInstancia(path, nome, comentario, gerado))
+            exit(3);
+        printf("Instância salva em %s\n", path);
+        freeGrafo(gerado);
+        return 0;
+    }
 
-    FILE *arq = fopen(path, "r");
+    tGrafo *grafo;
+    tGrade *gradeEntrada = NULL;
+    int fluxo = !strcmp(example_name, "-");
 
-    if (!arq)
-        exit(3);
+    if (fluxo)
+    {
+        // Entrada em fluxo: a grade espacial fica pronta junto com o último vértice lido
+        double inicio = agora();
+        grafo = leEntradaFluxo(stdin, name, sizeof(name), metrica, sizeof(metrica), &gradeEntrada);
+
+        if (!grafo)
+            exit(3);
+
+        dimension = getSizeVertices(grafo);
+        printf("Leitura em fluxo: %d vértices em %.3f s\n", dimension, agora() - inicio);
+    }
+    else
+    {
+        snprintf(path, sizeof(path), "exemplos/in/%s.tsp", example_name);
+
+        FILE *arq = fopen(path, "r");
+
+        if (!arq)
+            exit(3);
+
+        // --------------------- Lê o cabeçalho do arquivo --------------------- //
+
+        // Name
+        fscanf(arq, " %*s %s", name);
+        // Comment
+        fscanf(arq, " %*[^\n]");
+        // Type
+        fscanf(arq, " %*[^\n]");
+        // Dimension
+        fscanf(arq, " %*s %d", &dimension);
+        // Edge Weight Type
+        fscanf(arq, " %*s %49s", metrica);
+
+        // A frase "NODE_COORD_SECTION"
+        fscanf(arq, " %*[^\n]");
 
-    // --------------------- Lê o cabeçalho do arquivo --------------------- //
+        // --------------------- Lê os vértices do arquivo --------------------- //
 
-    // Name
-    fscanf(arq, " %*s %s", name);
-    // Comment
-    fscanf(arq, " %*[^\n]");
-    // Type
-    fscanf(arq, " %*[^\n]");
-    // Dimension
-    fscanf(arq, " %*s %d", &dimension);
-    // Edge Weight Type
-    fscanf(arq, " %*[^\n]");
+        grafo = initGrafo();
+        tVertice *vertice = initVertice(0, 0);
+        float x = 0, y = 0;
 
-    // A frase "NODE_COORD_SECTION"
-    fscanf(arq, " %*[^\n]");
+        setSizeVertices(grafo, dimension);
 
-    // --------------------- Lê os vértices do arquivo --------------------- //
+        for (int i = 0; i < dimension; i++)
+        {
+            fscanf(arq, " %*s %f %f\n", &x, &y);
+
+            reinitVertice(vertice, x, y);
 
-    tGrafo *grafo = initGrafo();
-    tVertice *vertice = initVertice(0, 0);
-    float x = 0, y = 0;
+            setVertice(grafo, i, vertice);
+        }
+
+        freeVertice(vertice);
+        fclose(arq);
+    }
 
-    setSizeVertices(grafo, dimension);
+    // -------------------------(Término da leitura)------------------------- //
 
-    for (int i = 0; i < dimension; i++)
+    // Com --hilbert todo o pipeline roda com os vértices renumerados; os ids originais voltam no fim
+    // Comprimento do tour ótimo de exemplos/opt, para os relatórios do AG e do LK (antes de renumerar)
+    double otimo = 0;
+    if (segundosAG > 0 || segundosLK > 0)
     {
-        fscanf(arq, " %*s %f %f\n", &x, &y);
+        snprintf(path, sizeof(path), "exemplos/opt/%s.opt.tour", example_name);
+        int *tourOtimo = leTour(path, dimension);
+        if (tourOtimo)
+        {
+            otimo = comprimentoTour(grafo, tourOtimo, dimension);
+            printf("Comprimento do tour ótimo (%s): %.2f\n", path, otimo);
+            free(tourOtimo);
+        }
+    }
 
-        reinitVertice(vertice, x, y);
+    int *ordem = NULL;
+    if (usaHilbert)
+    {
+        ordem = ordemHilbert(grafo);
+        renumeraGrafo(grafo, ordem);
 
-        setVertice(grafo, i, vertice);
+        // Os ids da grade da leitura eram os de antes da renumeração
+        if (gradeEntrada)
+        {
+            freeGrade(gradeEntrada);
+            gradeEntrada = NULL;
+        }
     }
 
-    freeVertice(vertice);
-    fclose(arq);
+    // Com cache válido, MST e candidatos vêm prontos e as arestas nem são criadas
+    unsigned long long hash = 0;
+    tCache *cache = NULL;
 
-    // -------------------------(Término da leitura)------------------------- //
+    if (usaCache)
+    {
+        hash = hashInstancia(grafo, metrica);
+        cache = abreCache(DIRETORIO_CACHE, hash, dimension);
+    }
 
-    initAllArestas(grafo);
-    sortArestas(grafo);
+    // Na partição (e no Christofides ou na entrada em fluxo acima de --denso vértices) o vetor de
+    // arestas completo (O(n²)) nunca é criado
+    int esparso = tamParticao > 0 || ((usaChristofides || fluxo) && dimension > limiteDenso);
+    if (!cache && !esparso)
+    {
+        initAllArestas(grafo);
+
+        // Renumerado, desempata pelos ids originais: MST e tour saem iguais aos sem --hilbert
+        if (ordem)
+            sortArestasPorIds(grafo, ordem);
+        else
+            sortArestas(grafo);
+    }
 
     // imprimeArestas(grafo);
 
     // ------------------------- (Execução do Algoritmo)------------------------- //
 
-    char path_out[50] = "exemplos/out/";
-    strcat(strcat(path_out, name), ".mst");
-    FILE *fMST = fopen(path_out, "w");
-    fprintf(fMST, "NAME: %s\n", name);
-    fprintf(fMST, "TYPE: MST\n");
-    fprintf(fMST, "DIMENSION: %d\n", dimension);
-    fprintf(fMST, "MST_SECTION\n");
-
-    char path_out2[50] = "exemplos/out/";
-    strcat(strcat(path_out2, name), ".tour");
-    FILE *fTour = fopen(path_out2, "w");
-    fprintf(fTour, "NAME: %s\n", name);
-    fprintf(fTour, "TYPE: TOUR\n");
-    fprintf(fTour, "DIMENSION: %d\n", dimension);
-    fprintf(fTour, "TOUR_SECTION\n");
-
     // De acordo com o algoritmo disponível em
     // https://en.wikipedia.org/wiki/Kruskal%27s_algorithm
-    tAresta **MST = kruskalAlgorithm(grafo, fMST, fTour);
+    tAresta **MST;
+    tVizinhos *vizinhos = NULL;
+    int qtdVizinhos = candidatosAlpha * 2 > 10 ? candidatosAlpha * 2 : 10;
+
+    if (cache)
+    {
+        MST = getMSTCache(cache, grafo);
+
+        if (getQtdVizinhosCache(cache) == qtdVizinhos)
+            vizinhos = getVizinhosCache(cache);
+
+        fechaCache(cache);
+    }
+    else
+    {
+        if (esparso && gradeEntrada)
+            MST = kruskalEsparsoGrade(grafo, gradeEntrada);
+        else if (esparso)
+            MST = kruskalEsparso(grafo);
+        else
+            MST = kruskalAlgorithm(grafo);
+
+        // Só a MST do Kruskal denso é gravada: a esparsa desempata de outro jeito e mudaria a
+        // saída das execuções seguintes que lessem o cache
+        if (usaCache && !esparso)
+        {
+            vizinhos = initVizinhos(grafo, qtdVizinhos);
+            salvaCache(DIRETORIO_CACHE, hash, grafo, MST, vizinhos);
+        }
+    }
+
+    if (gradeEntrada)
+        freeGrade(gradeEntrada);
+
+    if (!vizinhos && (partidas > 0 || iteracoesLimite > 0 || tamParticao > 0 || segundosAG > 0 || segundosLK > 0))
+        vizinhos = initVizinhos(grafo, qtdVizinhos);
 
     // Verificando se a MST foi gerada direitinho: Foi!
     // for (int i = 0; i < getSizeVertices(grafo) - 1; i++) {
@@ -125,80 +634,130 @@ int main()
 
     // Gerando o nosso TOUR
     int tam = getSizeVertices(grafo);
-    int tour[tam];
-    int insert_pos = 0;
+    int *tour = (int *)malloc((tam > 0 ? tam : 1) * sizeof(int));
+    const char *construcao = "caminhamento"; // Como o tour foi construído, para os relatórios
 
-    insereVetor(tour, tam, getV1(MST[0]), insert_pos);
-    insert_pos++;
-    insereVetor(tour, tam, getV2(MST[0]), insert_pos);
-    insert_pos++;
-    incPercorrida(MST[0]);
-    int vertAtual = getV2(MST[0]);
-    int flag_continuar_caminhamento = 1;
-    int i = 1;
+    if (tamParticao > 0)
+    {
+        double inicio = agora();
+        double comprimento = resolveParticionado(grafo, vizinhos, tamParticao, threads, tour);
+        construcao = "particionado";
 
-    int flagWhile = 0;
-    while (!todoPercorrido(MST, tam - 1) && flag_continuar_caminhamento)
+        printf("Comprimento do tour (particionado): %.2f\n", comprimento);
+        printf("Tempo da partição: %.3f s\n", agora() - inicio);
+    }
+    else if (usaChristofides)
     {
+        double inicio = agora();
+        double comprimento = christofides(grafo, MST, limiteEmparelhamento, tour);
+        construcao = "Christofides";
 
-        // printf("%d\n", flagWhile++);
+        printf("Comprimento do tour (Christofides): %.2f\n", comprimento);
+        printf("Tempo do Christofides: %.3f s\n", agora() - inicio);
+    }
+    else if (esparso)
+    {
+        // caminhamentoMST é O(n²): só fica no caminho denso, cuja saída é a de referência
+        caminhamentoPreOrdem(MST, tam, 0, tour);
+        construcao = "pré-ordem";
+    }
+    else
+        caminhamentoMST(MST, tam, tour);
 
-        /*for (int i = 0; i < insert_pos; i++) {
-            printf("%d ", tour[i] + 1);
-        }
-        printf("\n");*/
+    if (partidas > 0)
+    {
+        printf("Comprimento do tour (%s): %.2f\n", construcao, comprimentoTour(grafo, tour, tam));
 
-        for (; i < tam - 1; i++)
-        {
+        double comprimento = multiStart(grafo, MST, vizinhos, partidas, threads, chutes, semente, tour);
 
-            // Para cada aresta
-            if (getPercorrida(MST[i]) < 2)
-            {
+        printf("Comprimento do tour (multi-start): %.2f\n", comprimento);
+    }
 
-                int v1 = getV1(MST[i]);
-                int v2 = getV2(MST[i]);
-
-                if (vertAtual == v1)
-                {
-                    if (insereVetor(tour, tam, v2, insert_pos))
-                        insert_pos++;
-                    if (insert_pos == tam)
-                    {
-                        flag_continuar_caminhamento = 0;
-                        break;
-                    }
-                    vertAtual = v2;
-                    incPercorrida(MST[i]);
-                }
-                else if (vertAtual == v2)
-                {
-                    if (insereVetor(tour, tam, v1, insert_pos))
-                        insert_pos++;
-                    if (insert_pos == tam)
-                    {
-                        flag_continuar_caminhamento = 0;
-                        break;
-                    }
-                    vertAtual = v1;
-                    incPercorrida(MST[i]);
-                }
-            }
+    if (segundosAG > 0)
+    {
+        printf("Comprimento do tour (início do AG): %.2f\n", comprimentoTour(grafo, tour, tam));
+
+        double comprimento = algoritmoGenetico(grafo, MST, vizinhos, tour, threads, populacaoAG, segundosAG, migracaoAG,
+                                               semente, otimo, tour);
+
+        printf("Comprimento do tour (AG): %.2f\n", comprimento);
+    }
+
+    if (segundosLK > 0)
+    {
+        double comprimento = linKernighan(grafo, vizinhos, tour, candidatosLK, iteracoesLK < 0 ? tam : iteracoesLK,
+                                          segundosLK, semente, otimo);
+
+        printf("Comprimento do tour (LK): %.2f\n", comprimento);
+    }
+
+    if (tamJanela > 0)
+    {
+        printf("Comprimento do tour (antes das janelas): %.2f\n", comprimentoTour(grafo, tour, tam));
+
+        double comprimento = otimizaJanelas(grafo, tour, tamJanela, passadasJanela, threads);
+
+        printf("Comprimento do tour (janelas): %.2f\n", comprimento);
+    }
+
+    if (iteracoesLimite > 0 && tam >= 3)
+    {
+        double comprimento = comprimentoTour(grafo, tour, tam);
+
+        // As listas são maiores que o pedido: o alpha escolhe os melhores entre elas
+        tLimite *limite = initLimite(grafo, MST, vizinhos);
+
+        double estimativa = otimizaLimite(limite, iteracoesLimite, comprimento);
+        double certificado = certificaLimite(limite);
+
+        printf("Comprimento do tour: %.2f\n", comprimento);
+        printf("Limite inferior (Held-Karp, candidatos): %.2f\n", estimativa);
+        printf("Limite inferior (Held-Karp, certificado): %.2f\n", certificado);
+        printf("Gap certificado do tour: %.2f%%\n", 100.0 * (comprimento - certificado) / certificado);
+
+        if (candidatosAlpha > 0)
+        {
+            tVizinhos *alpha = vizinhosAlpha(limite, candidatosAlpha);
+            escreveCandidatos(alpha, name, tam, ordem);
+            freeVizinhos(alpha);
         }
-        i = 0;
+
+        freeLimite(limite);
     }
 
-    // Imprimir nosso tour no arquivo
-    for (int i = 0; i < tam; i++)
+    if (ordem)
     {
-        fprintf(fTour, "%d\n", tour[i] + 1);
+        restauraGrafo(grafo, ordem);
+        traduzMST(MST, tam - 1, ordem);
+        traduzIds(tour, tam, ordem);
+        free(ordem);
     }
 
-    fprintf(fMST, "EOF\n");
-    fprintf(fTour, "EOF\n");
+    if (arquivoDinamico)
+        executaDinamico(grafo, MST, tour, arquivoDinamico, name);
+
+    if (arquivoDesenho)
+        executaDesenho(grafo, MST, tour, arquivoDesenho, larguraDesenho, usaReferencia ? example_name : NULL);
+
+    // Grava MST e tour de uma vez, cada um com um buffer só
+    char path_out[128];
+    snprintf(path_out, sizeof(path_out), "exemplos/out/%s.mst", name);
+    escreveMSTTexto(path_out, name, MST, tam - 1, dimension);
+    snprintf(path_out, sizeof(path_out), "exemplos/out/%s.tour", name);
+    escreveTourTexto(path_out, name, tour, tam);
+
+    if (usaBinario)
+    {
+        snprintf(path_out, sizeof(path_out), "exemplos/out/%s.mstb", name);
+        escreveMSTBinario(path_out, MST, tam - 1, dimension);
+        snprintf(path_out, sizeof(path_out), "exemplos/out/%s.tourb", name);
+        escreveTourBinario(path_out, tour, tam);
+    }
 
-    fclose(fMST);
-    fclose(fTour);
-    // Liberar MST depois!
+    free(tour);
+    if (vizinhos)
+        freeVizinhos(vizinhos);
+    freeMST(MST);
     freeGrafo(grafo);
 
     return 0;
@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "multistart.h"
+#include "tour.h"
+#include "aleatorio.h"
+
+typedef struct stTrabalhador tTrabalhador;
+
+struct stTrabalhador
+{
+    int id;
+
+    tGrafo *grafo;
+    tAresta **MST;
+    tVizinhos *vizinhos;
+    const int *tourInicial; // Ponto de partida da partida 0
+
+    int partidas;
+    int threads;
+    int chutes;
+    unsigned long long semente;
+
+    // Melhor chave global: (bits do comprimento << 32) | partida
+    _Atomic unsigned long long *melhorGlobal;
+
+    // Buffers exclusivos da thread
+    tTour *melhorLocal;
+    unsigned long long chaveLocal;
+};
+
+static void *executaTrabalhador(void *arg)
+{
+    tTrabalhador *t = (tTrabalhador *)arg;
+    int n = getSizeVertices(t->grafo);
+
+    tTour *atual = initTour(n);
+    tTour *salvo = initTour(n);
+    int *inicial = (int *)malloc(n * sizeof(int));
+
+    // Partidas distribuídas de forma fixa: partida p fica com a thread p % threads
+    for (int p = t->id; p < t->partidas; p += t->threads)
+    {
+        tAleatorio *aleatorio = initAleatorio(sementeDerivada(t->semente, p));
+
+        if (p == 0)
+            memcpy(inicial, t->tourInicial, n * sizeof(int));
+        else
+            caminhamentoPreOrdem(t->MST, n, aleatorioIntervalo(aleatorio, n), inicial);
+        setCidadesTour(atual, inicial);
+
+        double comprimento = comprimentoTour(t->grafo, inicial, n) - doisOpt(t->grafo, t->vizinhos, atual);
+        copiaTour(salvo, atual);
+
+        for (int c = 0; c < t->chutes && n >= 8; c++)
+        {
+            double novo = comprimento + doubleBridge(t->grafo, atual, aleatorio);
+            novo -= doisOpt(t->grafo, t->vizinhos, atual);
+
+            if (novo < comprimento - 1e-6)
+            {
+                comprimento = novo;
+                copiaTour(salvo, atual);
+            }
+            else
+                copiaTour(atual, salvo);
+        }
+
+        freeAleatorio(aleatorio);
+
+        // Recalcula do zero para não acumular erro de arredondamento
+        comprimento = comprimentoTour(t->grafo, getCidadesTour(salvo), n);
+        unsigned long long chave = chaveComprimento(comprimento, p);
+
+        if (chave < t->chaveLocal)
+        {
+            t->chaveLocal = chave;
+            copiaTour(t->melhorLocal, salvo);
+        }
+
+        // Redução sem trava: só troca se a chave ainda for a menor
+        unsigned long long global = atomic_load(t->melhorGlobal);
+        while (chave < global && !atomic_compare_exchange_weak(t->melhorGlobal, &global, chave))
+            ;
+    }
+
+    freeTour(atual);
+    freeTour(salvo);
+    free(inicial);
+
+    return NULL;
+}
+
+double multiStart(tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos, int partidas, int threads, int chutes,
+                  unsigned long long semente, int *tour)
+{
+    int n = getSizeVertices(grafo);
+
+    if (threads > partidas)
+        threads = partidas;
+
+    _Atomic unsigned long long melhorGlobal = ~0ULL;
+    tTrabalhador *trabalhadores = (tTrabalhador *)malloc(threads * sizeof(tTrabalhador));
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+
+    for (int i = 0; i < threads; i++)
+    {
+        tTrabalhador *t = &trabalhadores[i];
+
+        t->id = i;
+        t->grafo = grafo;
+        t->MST = MST;
+        t->vizinhos = vizinhos;
+        t->tourInicial = tour;
+        t->partidas = partidas;
+        t->threads = threads;
+        t->chutes = chutes;
+        t->semente = semente;
+        t->melhorGlobal = &melhorGlobal;
+        t->melhorLocal = initTour(n);
+        t->chaveLocal = ~0ULL;
+
+        pthread_create(&ids[i], NULL, executaTrabalhador, t);
+    }
+
+    for (int i = 0; i < threads; i++)
+        pthread_join(ids[i], NULL);
+
+    // A melhor partida está no buffer da thread que a executou
+    int vencedora = (int)(atomic_load(&melhorGlobal) & 0xFFFFFFFFULL);
+    tTour *melhor = trabalhadores[vencedora % threads].melhorLocal;
+
+    memcpy(tour, getCidadesTour(melhor), n * sizeof(int));
+    double comprimento = comprimentoTour(grafo, tour, n);
+
+    for (int i = 0; i < threads; i++)
+        freeTour(trabalhadores[i].melhorLocal);
+    free(trabalhadores);
+    free(ids);
+
+    return comprimento;
+}
@@ -0,0 +1,30 @@
+#ifndef MULTISTART_H
+#define MULTISTART_H
+
+#include "grafo.h"
+#include "vizinhos.h"
+
+/**
+ * @brief Melhora o tour com várias partidas aleatórias em paralelo e fica com a melhor
+ * @details A partida 0 começa do tour recebido (caminhamento, Christofides ou partição); as
+ * outras, da pré-ordem da MST a partir de uma raiz sorteada. Cada uma passa pelo 2-opt e depois por perturbações double-bridge (aceitas só se melhoram o tour).
+ * Cada partida tem seu próprio gerador, derivado de (semente, número da partida), e cada
+ * thread tem seus próprios tours: o resultado só depende da semente, não do escalonamento.
+ * A melhor partida é escolhida sem travas (compare-and-swap), com empate resolvido pelo
+ * menor número de partida.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param vizinhos Listas de candidatos para o 2-opt
+ * @param partidas Quantidade de partidas
+ * @param threads Quantidade de threads
+ * @param chutes Quantidade de perturbações por partida
+ * @param semente Semente global
+ * @param tour Entrada: tour da partida 0; saída: o melhor tour (Qtd_vértices posições)
+ * @pre partidas >= 1, threads >= 1
+ * @return Comprimento do melhor tour
+ */
+double multiStart(tGrafo *grafo, tAresta **MST, tVizinhos *vizinhos, int partidas, int threads, int chutes,
+                  unsigned long long semente, int *tour);
+
+#endif
@@ -0,0 +1,415 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "particao.h"
+#include "grade.h"
+#include "tour.h"
+#include "UF.h"
+
+typedef struct
+{
+    float peso;
+    int a, b;
+} tArestaYao;
+
+typedef struct
+{
+    float chave;
+    int vertice;
+} tChave;
+
+// Célula da partição: vértices indices[inicio .. fim - 1]
+typedef struct
+{
+    int inicio, fim;
+    float cx, cy; // Centróide
+} tCelulaParticao;
+
+typedef struct stParticao tParticao;
+
+struct stParticao
+{
+    tGrafo *grafo;
+    int *indices; // Vértices agrupados por célula (e, depois de resolver, na ordem do ciclo)
+
+    tCelulaParticao *celulas;
+    int qtdCelulas, capCelulas;
+
+    _Atomic int proximaCelula;
+};
+
+static int compArestaYao(const void *p1, const void *p2)
+{
+    const tArestaYao *a = (const tArestaYao *)p1;
+    const tArestaYao *b = (const tArestaYao *)p2;
+
+    return (a->peso > b->peso) - (a->peso < b->peso);
+}
+
+static int compChave(const void *p1, const void *p2)
+{
+    const tChave *a = (const tChave *)p1;
+    const tChave *b = (const tChave *)p2;
+
+    if (a->chave != b->chave)
+        return (a->chave > b->chave) - (a->chave < b->chave);
+    return a->vertice - b->vertice;
+}
+
+tAresta **kruskalEsparso(tGrafo *grafo)
+{
+    int n = getSizeVertices(grafo);
+
+    // Células do tamanho do espaçamento médio entre pontos
+    float minX = 0, maxX = 0, minY = 0, maxY = 0;
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        if (i == 0 || getX(v) < minX)
+            minX = getX(v);
+        if (i == 0 || getX(v) > maxX)
+            maxX = getX(v);
+        if (i == 0 || getY(v) < minY)
+            minY = getY(v);
+        if (i == 0 || getY(v) > maxY)
+            maxY = getY(v);
+    }
+    float area = (maxX - minX) * (maxY - minY);
+    tGrade *grade = initGrade(n > 0 && area > 0 ? sqrtf(area / n) : 1);
+
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        insereGrade(grade, i, getX(v), getY(v));
+    }
+
+    tAresta **MST = kruskalEsparsoGrade(grafo, grade);
+    freeGrade(grade);
+
+    return MST;
+}
+
+tAresta **kruskalEsparsoGrade(tGrafo *grafo, tGrade *grade)
+{
+    int n = getSizeVertices(grafo);
+
+    tArestaYao *arestas = (tArestaYao *)malloc((size_t)8 * (n > 0 ? n : 1) * sizeof(tArestaYao));
+    size_t qtd = 0;
+    int cones[8];
+
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        buscaConesGrade(grade, getX(v), getY(v), i, cones);
+
+        for (int s = 0; s < 8; s++)
+        {
+            // Aresta nos dois sentidos só entra uma vez
+            if (cones[s] < 0)
+                continue;
+            arestas[qtd].peso = distVertices(grafo, i, cones[s]);
+            arestas[qtd].a = i < cones[s] ? i : cones[s];
+            arestas[qtd].b = i < cones[s] ? cones[s] : i;
+            qtd++;
+        }
+    }
+
+    qsort(arestas, qtd, sizeof(tArestaYao), compArestaYao);
+
+    int *pares = (int *)malloc(2 * (n > 1 ? n - 1 : 1) * sizeof(int));
+    tUF *F = InitUnionFind(n);
+    int j = 0;
+
+    for (size_t i = 0; i < qtd && j < n - 1; i++)
+    {
+        if (IsConnected(F, arestas[i].a, arestas[i].b))
+            continue;
+
+        Union(F, arestas[i].a, arestas[i].b);
+        pares[2 * j] = arestas[i].a;
+        pares[2 * j + 1] = arestas[i].b;
+        j++;
+    }
+
+    freeUnionFind(F);
+    free(arestas);
+
+    tAresta **MST = initMST(grafo, pares, j);
+    free(pares);
+
+    return MST;
+}
+
+// ---------------------------- Partição ---------------------------- //
+
+static void divide(tParticao *p, tChave *chaves, int inicio, int fim, int tamCelula)
+{
+    int n = fim - inicio;
+
+    if (n <= tamCelula)
+    {
+        if (p->qtdCelulas == p->capCelulas)
+        {
+            p->capCelulas *= 2;
+            p->celulas = (tCelulaParticao *)realloc(p->celulas, p->capCelulas * sizeof(tCelulaParticao));
+        }
+
+        tCelulaParticao *c = &(p->celulas[p->qtdCelulas++]);
+        c->inicio = inicio;
+        c->fim = fim;
+        c->cx = c->cy = 0;
+        for (int i = inicio; i < fim; i++)
+        {
+            tVertice *v = getVertice(p->grafo, p->indices[i]);
+            c->cx += getX(v) / n;
+            c->cy += getY(v) / n;
+        }
+        return;
+    }
+
+    float minX = HUGE_VALF, maxX = -HUGE_VALF, minY = HUGE_VALF, maxY = -HUGE_VALF;
+    for (int i = inicio; i < fim; i++)
+    {
+        tVertice *v = getVertice(p->grafo, p->indices[i]);
+        minX = fminf(minX, getX(v));
+        maxX = fmaxf(maxX, getX(v));
+        minY = fminf(minY, getY(v));
+        maxY = fmaxf(maxY, getY(v));
+    }
+
+    // Corta o lado maior na mediana
+    int usaX = maxX - minX >= maxY - minY;
+    for (int i = inicio; i < fim; i++)
+    {
+        tVertice *v = getVertice(p->grafo, p->indices[i]);
+        chaves[i - inicio].chave = usaX ? getX(v) : getY(v);
+        chaves[i - inicio].vertice = p->indices[i];
+    }
+    qsort(chaves, n, sizeof(tChave), compChave);
+    for (int i = inicio; i < fim; i++)
+        p->indices[i] = chaves[i - inicio].vertice;
+
+    int meio = inicio + n / 2;
+    divide(p, chaves, inicio, meio, tamCelula);
+    divide(p, chaves, meio, fim, tamCelula);
+}
+
+// Pipeline normal na célula: o resultado é o ciclo, escrito por cima de indices[inicio .. fim - 1]
+static void resolveCelula(tParticao *p, tCelulaParticao *c)
+{
+    int n = c->fim - c->inicio;
+    int *ids = &(p->indices[c->inicio]);
+
+    if (n < 3)
+        return;
+
+    tGrafo *sub = initGrafo();
+    setSizeVertices(sub, n);
+    for (int i = 0; i < n; i++)
+        setVertice(sub, i, getVertice(p->grafo, ids[i]));
+
+    initAllArestas(sub);
+    sortArestas(sub);
+    tAresta **MST = kruskalAlgorithm(sub);
+
+    int *ciclo = (int *)malloc(n * sizeof(int));
+    caminhamentoPreOrdem(MST, n, 0, ciclo);
+
+    tVizinhos *vizinhos = initVizinhos(sub, 8);
+    tTour *tour = initTour(n);
+    setCidadesTour(tour, ciclo);
+    doisOpt(sub, vizinhos, tour);
+
+    int *melhorado = getCidadesTour(tour);
+    for (int i = 0; i < n; i++)
+        ciclo[i] = ids[melhorado[i]];
+    memcpy(ids, ciclo, n * sizeof(int));
+
+    freeTour(tour);
+    freeVizinhos(vizinhos);
+    free(ciclo);
+    freeMST(MST);
+    freeGrafo(sub);
+}
+
+static void *trabalhadorParticao(void *arg)
+{
+    tParticao *p = (tParticao *)arg;
+    int c;
+
+    while ((c = atomic_fetch_add(&p->proximaCelula, 1)) < p->qtdCelulas)
+        resolveCelula(p, &(p->celulas[c]));
+
+    return NULL;
+}
+
+// Ordem de visita das células: tour (MST + 2-opt) sobre os centróides
+static void ordenaCelulas(tParticao *p, int *ordem)
+{
+    int m = p->qtdCelulas;
+
+    if (m < 4)
+    {
+        for (int i = 0; i < m; i++)
+            ordem[i] = i;
+        return;
+    }
+
+    tGrafo *centroides = initGrafo();
+    setSizeVertices(centroides, m);
+    tVertice *vertice = initVertice(0, 0);
+    for (int i = 0; i < m; i++)
+    {
+        reinitVertice(vertice, p->celulas[i].cx, p->celulas[i].cy);
+        setVertice(centroides, i, vertice);
+    }
+    freeVertice(vertice);
+
+    tAresta **MST = kruskalEsparso(centroides);
+    caminhamentoPreOrdem(MST, m, 0, ordem);
+
+    tVizinhos *vizinhos = initVizinhos(centroides, 8);
+    tTour *tour = initTour(m);
+    setCidadesTour(tour, ordem);
+    doisOpt(centroides, vizinhos, tour);
+    memcpy(ordem, getCidadesTour(tour), m * sizeof(int));
+
+    freeTour(tour);
+    freeVizinhos(vizinhos);
+    freeMST(MST);
+    freeGrafo(centroides);
+}
+
+/**
+ * @brief Costura os ciclos das células, na ordem dada, em um único tour
+ * @details Cada ciclo vira um caminho: tira-se a aresta (e escolhe-se o sentido) que minimiza
+ * a ligação com o fim do caminho anterior, menos a aresta removida, mais a distância até o
+ * centróide da próxima célula.
+ */
+static void costura(tParticao *p, int *ordem, int *tour)
+{
+    tGrafo *g = p->grafo;
+    int qtd = 0;
+    int fimAnterior = -1;
+
+    for (int k = 0; k < p->qtdCelulas; k++)
+    {
+        tCelulaParticao *c = &(p->celulas[ordem[k]]);
+        tCelulaParticao *seguinte = &(p->celulas[ordem[(k + 1) % p->qtdCelulas]]);
+        int *ciclo = &(p->indices[c->inicio]);
+        int n = c->fim - c->inicio;
+
+        int melhorI = 0, melhorSentido = 0;
+        double melhorCusto = HUGE_VAL;
+
+        for (int i = 0; i < n; i++)
+        {
+            int u = ciclo[i], v = ciclo[(i + 1) % n];
+            double removida = n > 1 ? distVertices(g, u, v) : 0;
+
+            // Sentido 0: começa em v e termina em u; sentido 1: começa em u e termina em v
+            for (int sentido = 0; sentido < 2; sentido++)
+            {
+                int comeco = sentido == 0 ? v : u;
+                int final = sentido == 0 ? u : v;
+                tVertice *vf = getVertice(g, final);
+                double dx = getX(vf) - seguinte->cx, dy = getY(vf) - seguinte->cy;
+
+                double custo = -removida + sqrt(dx * dx + dy * dy);
+                if (fimAnterior >= 0)
+                    custo += distVertices(g, fimAnterior, comeco);
+
+                if (custo < melhorCusto)
+                {
+                    melhorCusto = custo;
+                    melhorI = i;
+                    melhorSentido = sentido;
+                }
+            }
+        }
+
+        for (int j = 0; j < n; j++)
+        {
+            if (melhorSentido == 0)
+                tour[qtd++] = ciclo[(melhorI + 1 + j) % n];
+            else
+                tour[qtd++] = ciclo[((melhorI - j) % n + n) % n];
+        }
+        fimAnterior = tour[qtd - 1];
+    }
+}
+
+double resolveParticionado(tGrafo *grafo, tVizinhos *vizinhos, int tamCelula, int threads, int *tour)
+{
+    int n = getSizeVertices(grafo);
+
+    if (tamCelula < 3)
+        tamCelula = 3;
+    if (threads < 1)
+        threads = 1;
+
+    tParticao p;
+    p.grafo = grafo;
+    p.indices = (int *)malloc(n * sizeof(int));
+    p.capCelulas = 16;
+    p.qtdCelulas = 0;
+    p.celulas = (tCelulaParticao *)malloc(p.capCelulas * sizeof(tCelulaParticao));
+    atomic_init(&p.proximaCelula, 0);
+
+    for (int i = 0; i < n; i++)
+        p.indices[i] = i;
+
+    tChave *chaves = (tChave *)malloc(n * sizeof(tChave));
+    divide(&p, chaves, 0, n, tamCelula);
+    free(chaves);
+
+    // Células em paralelo: cada thread pega a próxima célula livre
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++)
+        pthread_create(&ids[t], NULL, trabalhadorParticao, &p);
+    for (int t = 0; t < threads; t++)
+        pthread_join(ids[t], NULL);
+    free(ids);
+
+    int *ordem = (int *)malloc(p.qtdCelulas * sizeof(int));
+    ordenaCelulas(&p, ordem);
+    costura(&p, ordem, tour);
+
+    // Célula de cada vértice, para achar a fronteira
+    int *celulaDe = (int *)malloc(n * sizeof(int));
+    for (int c = 0; c < p.qtdCelulas; c++)
+        for (int i = p.celulas[c].inicio; i < p.celulas[c].fim; i++)
+            celulaDe[p.indices[i]] = c;
+
+    tTour *melhorado = initTour(n);
+    setCidadesTour(melhorado, tour);
+    desativaCidadesTour(melhorado);
+
+    int k = getQtdVizinhos(vizinhos);
+    for (int v = 0; v < n; v++)
+    {
+        int *lista = getVizinhos(vizinhos, v);
+        for (int j = 0; j < k; j++)
+        {
+            if (celulaDe[lista[j]] != celulaDe[v])
+            {
+                ativaCidadeTour(melhorado, v);
+                break;
+            }
+        }
+    }
+
+    doisOpt(grafo, vizinhos, melhorado);
+    memcpy(tour, getCidadesTour(melhorado), n * sizeof(int));
+
+    freeTour(melhorado);
+    free(celulaDe);
+    free(ordem);
+    free(p.celulas);
+    free(p.indices);
+
+    return comprimentoTour(grafo, tour, n);
+}
@@ -0,0 +1,45 @@
+#ifndef PARTICAO_H
+#define PARTICAO_H
+
+#include "grafo.h"
+#include "vizinhos.h"
+#include "grade.h"
+
+/**
+ * @brief Gera a MST euclidiana sem o vetor de arestas completo
+ * @details Kruskal + UF sobre o grafo de Yao (vizinho mais próximo em cada setor de 45 graus),
+ * que contém a MST euclidiana. O(n log n), serve para instâncias de centenas de milhares de pontos.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @return tAresta** (liberar com freeMST)
+ */
+tAresta **kruskalEsparso(tGrafo *grafo);
+
+/**
+ * @brief Igual à kruskalEsparso, mas com uma grade já pronta
+ * @details Serve quando a grade foi montada antes (ex.: durante a leitura em fluxo).
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param grade Grade com todos os vértices, com id == índice no grafo (não é liberada)
+ * @return tAresta** (liberar com freeMST)
+ */
+tAresta **kruskalEsparsoGrade(tGrafo *grafo, tGrade *grade);
+
+/**
+ * @brief Resolve a instância por partição geométrica (estilo Karp)
+ * @details Divide os vértices recursivamente ao meio, pelo lado maior da caixa, até as células
+ * terem no máximo tamCelula vértices. Cada célula passa pelo pipeline normal (initAllArestas,
+ * sortArestas, kruskalAlgorithm, caminhamento e 2-opt) em paralelo. Os ciclos das células são
+ * costurados na ordem de um tour sobre os centróides, e no fim um 2-opt parte só dos vértices
+ * de fronteira (com algum candidato em outra célula).
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param vizinhos Listas de candidatos do grafo inteiro
+ * @param tamCelula Máximo de vértices por célula
+ * @param threads Quantidade de threads
+ * @param tour Vetor de saída, com Qtd_vértices posições
+ * @return Comprimento do tour
+ */
+double resolveParticionado(tGrafo *grafo, tVizinhos *vizinhos, int tamCelula, int threads, int *tour);
+
+#endif
@@ -0,0 +1,536 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#if defined(__SSE__)
+#include <immintrin.h>
+#endif
+#include "pequenas.h"
+#include "tempo.h"
+#include "grafo.h"
+#include "tour.h"
+#include "vizinhos.h"
+#include "aleatorio.h"
+
+// Instâncias por bloco (uma por lane): a largura do registrador vetorial disponível
+#if defined(__AVX__)
+#define LARGURA_SIMD 8
+#else
+#define LARGURA_SIMD 4
+#endif
+#define MIN_VERTICES_TESTE 5  // Tamanhos das instâncias do executaPequenas
+#define MAX_VERTICES_TESTE 60
+#define MAX_REFERENCIA 2000   // Instâncias que também passam pelo pipeline normal
+#define EPSILON_2OPT 1e-4f    // Melhora mínima para aplicar um movimento
+#define POSICOES (MAX_VERTICES_PEQUENA + 1) // Uma posição a mais para a cópia da primeira cidade
+
+typedef float tVetorF __attribute__((vector_size(4 * LARGURA_SIMD)));
+typedef int tVetorI __attribute__((vector_size(4 * LARGURA_SIMD)));
+
+struct stPequenas
+{
+    // Bloco atual como estrutura de vetores: [vértice ou posição][lane]
+    tVetorF x[POSICOES], y[POSICOES]; // Coordenadas por vértice
+    tVetorF chave[POSICOES];          // Prim: menor distância² até a árvore
+    tVetorI pai[POSICOES];            // Prim: vértice da árvore mais perto
+    tVetorI dentro[POSICOES];         // Prim: -1 se o vértice já está na árvore
+    tVetorF tx[POSICOES], ty[POSICOES]; // Coordenadas na ordem do tour
+    tVetorF aresta[POSICOES];         // aresta[p] == distância entre as posições p e p + 1
+
+    int cidade[LARGURA_SIMD][POSICOES]; // Vértice em cada posição do tour
+    int n[LARGURA_SIMD];
+    double pesoMST[LARGURA_SIMD];
+
+    // Pré-ordem da MST
+    int inicioFilhos[POSICOES + 1];
+    int filhos[POSICOES];
+    int pilha[POSICOES];
+
+    // Instâncias ordenadas por tamanho (único espaço que cresce, por chamada)
+    int *ordem;
+    int capOrdem;
+};
+
+// ---------------------------- Operações em lanes ---------------------------- //
+
+static inline tVetorF espalhaF(float valor)
+{
+    tVetorF v;
+    for (int l = 0; l < LARGURA_SIMD; l++)
+        v[l] = valor;
+    return v;
+}
+
+static inline tVetorI espalhaI(int valor)
+{
+    tVetorI v;
+    for (int l = 0; l < LARGURA_SIMD; l++)
+        v[l] = valor;
+    return v;
+}
+
+// Lane a lane: a onde a máscara é -1, b onde é 0
+static inline tVetorF misturaF(tVetorI mascara, tVetorF a, tVetorF b)
+{
+    return (tVetorF)(((tVetorI)a & mascara) | ((tVetorI)b & ~mascara));
+}
+
+static inline tVetorI misturaI(tVetorI mascara, tVetorI a, tVetorI b)
+{
+    return (a & mascara) | (b & ~mascara);
+}
+
+static inline tVetorF raiz(tVetorF v)
+{
+#if defined(__AVX__) && LARGURA_SIMD == 8
+    return (tVetorF)_mm256_sqrt_ps((__m256)v);
+#elif defined(__SSE__) && LARGURA_SIMD % 4 == 0
+    union
+    {
+        tVetorF v;
+        __m128 q[LARGURA_SIMD / 4];
+    } u = {v};
+    for (int i = 0; i < LARGURA_SIMD / 4; i++)
+        u.q[i] = _mm_sqrt_ps(u.q[i]);
+    return u.v;
+#else
+    for (int l = 0; l < LARGURA_SIMD; l++)
+        v[l] = sqrtf(v[l]);
+    return v;
+#endif
+}
+
+static inline tVetorF distancia(tVetorF x1, tVetorF y1, tVetorF x2, tVetorF y2)
+{
+    tVetorF dx = x1 - x2;
+    tVetorF dy = y1 - y2;
+    return raiz(dx * dx + dy * dy);
+}
+
+// ----------------------------- Fases do bloco ----------------------------- //
+
+static void primBloco(tPequenas *p, int nMax, tVetorI nv)
+{
+    tVetorF infinito = espalhaF(HUGE_VALF);
+
+    for (int j = 0; j < nMax; j++)
+    {
+        p->chave[j] = infinito;
+        p->pai[j] = espalhaI(0);
+        p->dentro[j] = espalhaI(0);
+    }
+    p->dentro[0] = espalhaI(-1);
+
+    tVetorF bx = p->x[0], by = p->y[0];
+    tVetorI atual = espalhaI(0);
+
+    for (int l = 0; l < LARGURA_SIMD; l++)
+        p->pesoMST[l] = 0;
+
+    for (int passo = 1; passo < nMax; passo++)
+    {
+        tVetorF melhorChave = infinito;
+        tVetorI melhorVertice = espalhaI(0);
+
+        for (int j = 1; j < nMax; j++)
+        {
+            tVetorF dx = p->x[j] - bx;
+            tVetorF dy = p->y[j] - by;
+            tVetorF d2 = dx * dx + dy * dy;
+
+            tVetorI livre = ~p->dentro[j] & (espalhaI(j) < nv);
+            tVetorI melhora = livre & (d2 < p->chave[j]);
+            p->chave[j] = misturaF(melhora, d2, p->chave[j]);
+            p->pai[j] = misturaI(melhora, atual, p->pai[j]);
+
+            tVetorF candidata = misturaF(livre, p->chave[j], infinito);
+            tVetorI menor = candidata < melhorChave;
+            melhorChave = misturaF(menor, candidata, melhorChave);
+            melhorVertice = misturaI(menor, espalhaI(j), melhorVertice);
+        }
+
+        // O vértice escolhido é diferente em cada lane
+        for (int l = 0; l < LARGURA_SIMD; l++)
+        {
+            if (passo >= p->n[l])
+                continue;
+
+            int b = melhorVertice[l];
+            p->dentro[b][l] = -1;
+            bx[l] = p->x[b][l];
+            by[l] = p->y[b][l];
+            atual[l] = b;
+            p->pesoMST[l] += sqrtf(melhorChave[l]);
+        }
+    }
+}
+
+static void preOrdemLane(tPequenas *p, int l)
+{
+    int n = p->n[l];
+
+    memset(p->inicioFilhos, 0, (n + 1) * sizeof(int));
+    for (int v = 1; v < n; v++)
+        p->inicioFilhos[p->pai[v][l] + 1]++;
+    for (int v = 0; v < n; v++)
+        p->inicioFilhos[v + 1] += p->inicioFilhos[v];
+
+    // Preenche de trás para frente: os filhos ficam em ordem decrescente e saem da pilha em ordem
+    for (int v = n - 1; v >= 1; v--)
+    {
+        int u = p->pai[v][l];
+        p->filhos[p->inicioFilhos[u]++] = v;
+    }
+    for (int v = n; v > 0; v--)
+        p->inicioFilhos[v] = p->inicioFilhos[v - 1];
+    p->inicioFilhos[0] = 0;
+
+    int topo = 0, qtd = 0;
+    p->pilha[topo++] = 0;
+    while (topo > 0)
+    {
+        int v = p->pilha[--topo];
+        p->cidade[l][qtd++] = v;
+        for (int f = p->inicioFilhos[v]; f < p->inicioFilhos[v + 1]; f++)
+            p->pilha[topo++] = p->filhos[f];
+    }
+}
+
+static void recalculaArestaLane(tPequenas *p, int l, int pos)
+{
+    float dx = p->tx[pos][l] - p->tx[pos + 1][l];
+    float dy = p->ty[pos][l] - p->ty[pos + 1][l];
+    p->aresta[pos][l] = sqrtf(dx * dx + dy * dy);
+}
+
+// 2-opt: para cada i, cada lane aplica o melhor movimento (i, j) já na mesma passada
+static void doisOptBloco(tPequenas *p, int nMax, tVetorI nv)
+{
+    for (int pos = 0; pos < nMax; pos++)
+        p->aresta[pos] = distancia(p->tx[pos], p->ty[pos], p->tx[pos + 1], p->ty[pos + 1]);
+
+    int algum = 1;
+    while (algum)
+    {
+        algum = 0;
+
+        for (int i = 0; i + 2 < nMax; i++)
+        {
+            tVetorF xi = p->tx[i], yi = p->ty[i];
+            tVetorF xi1 = p->tx[i + 1], yi1 = p->ty[i + 1];
+            tVetorF ei = p->aresta[i];
+            tVetorF melhorDelta = espalhaF(-EPSILON_2OPT);
+            tVetorI melhorJ = espalhaI(-1);
+
+            for (int j = i + 2; j < nMax; j++)
+            {
+                tVetorF delta = distancia(xi, yi, p->tx[j], p->ty[j]) +
+                                distancia(xi1, yi1, p->tx[j + 1], p->ty[j + 1]) - ei - p->aresta[j];
+
+                tVetorI vj = espalhaI(j);
+                tVetorI melhora = (delta < melhorDelta) & (vj < nv);
+                melhorDelta = misturaF(melhora, delta, melhorDelta);
+                melhorJ = misturaI(melhora, vj, melhorJ);
+            }
+
+            // Inverte as posições i + 1 .. j nas lanes que acharam melhora
+            for (int l = 0; l < LARGURA_SIMD; l++)
+            {
+                if (melhorJ[l] < 0)
+                    continue;
+
+                algum = 1;
+                for (int a = i + 1, b = melhorJ[l]; a < b; a++, b--)
+                {
+                    float fx = p->tx[a][l], fy = p->ty[a][l];
+                    int c = p->cidade[l][a];
+                    p->tx[a][l] = p->tx[b][l];
+                    p->ty[a][l] = p->ty[b][l];
+                    p->cidade[l][a] = p->cidade[l][b];
+                    p->tx[b][l] = fx;
+                    p->ty[b][l] = fy;
+                    p->cidade[l][b] = c;
+                }
+                for (int pos = i; pos <= melhorJ[l]; pos++)
+                    recalculaArestaLane(p, l, pos);
+            }
+        }
+    }
+}
+
+static void resolveBloco(tPequenas *p, const int *ids, int qtdLanes, const int *inicio, const float *xs,
+                         const float *ys, int *tours, double *comprimentos, double *pesosMST)
+{
+    int nMax = 0;
+
+    for (int l = 0; l < LARGURA_SIMD; l++)
+    {
+        p->n[l] = l < qtdLanes ? inicio[ids[l] + 1] - inicio[ids[l]] : 0;
+        if (p->n[l] > nMax)
+            nMax = p->n[l];
+    }
+
+    tVetorI nv;
+    for (int l = 0; l < LARGURA_SIMD; l++)
+        nv[l] = p->n[l];
+
+    for (int l = 0; l < LARGURA_SIMD; l++)
+    {
+        const float *x = l < qtdLanes ? xs + inicio[ids[l]] : NULL;
+        const float *y = l < qtdLanes ? ys + inicio[ids[l]] : NULL;
+        for (int j = 0; j < nMax; j++)
+        {
+            p->x[j][l] = j < p->n[l] ? x[j] : 0;
+            p->y[j][l] = j < p->n[l] ? y[j] : 0;
+        }
+    }
+
+    primBloco(p, nMax, nv);
+
+    // Tour na ordem da pré-ordem; as posições n .. nMax repetem a primeira cidade
+    for (int l = 0; l < LARGURA_SIMD; l++)
+    {
+        if (p->n[l] > 0)
+            preOrdemLane(p, l);
+        else
+            p->cidade[l][0] = 0;
+
+        for (int pos = 0; pos <= nMax; pos++)
+        {
+            int v = pos < p->n[l] ? p->cidade[l][pos] : p->cidade[l][0];
+            p->tx[pos][l] = p->x[v][l];
+            p->ty[pos][l] = p->y[v][l];
+        }
+    }
+
+    doisOptBloco(p, nMax, nv);
+
+    for (int l = 0; l < qtdLanes; l++)
+    {
+        int id = ids[l];
+        double comprimento = 0;
+
+        for (int pos = 0; pos < p->n[l]; pos++)
+        {
+            tours[inicio[id] + pos] = p->cidade[l][pos];
+            comprimento += p->aresta[pos][l];
+        }
+
+        comprimentos[id] = comprimento;
+        if (pesosMST)
+            pesosMST[id] = p->pesoMST[l];
+    }
+}
+
+// ---------------------------------- API ---------------------------------- //
+
+tPequenas *initPequenas()
+{
+    // Os vetores SIMD pedem alinhamento de 32 bytes
+    size_t tam = (sizeof(tPequenas) + 31) / 32 * 32;
+    tPequenas *p = (tPequenas *)aligned_alloc(32, tam);
+
+    p->ordem = NULL;
+    p->capOrdem = 0;
+
+    return p;
+}
+
+void freePequenas(tPequenas *pequenas)
+{
+    free(pequenas->ordem);
+    free(pequenas);
+}
+
+void resolvePequenas(tPequenas *pequenas, int qtd, const int *inicio, const float *xs, const float *ys, int *tours,
+                     double *comprimentos, double *pesosMST)
+{
+    tPequenas *p = pequenas;
+
+    if (qtd > p->capOrdem)
+    {
+        p->capOrdem = qtd;
+        p->ordem = (int *)realloc(p->ordem, qtd * sizeof(int));
+    }
+
+    // Counting sort por tamanho: cada bloco fica com instâncias de tamanhos parecidos
+    int posTamanho[MAX_VERTICES_PEQUENA + 2] = {0};
+    for (int i = 0; i < qtd; i++)
+        posTamanho[inicio[i + 1] - inicio[i] + 1]++;
+    for (int t = 0; t <= MAX_VERTICES_PEQUENA; t++)
+        posTamanho[t + 1] += posTamanho[t];
+    for (int i = 0; i < qtd; i++)
+        p->ordem[posTamanho[inicio[i + 1] - inicio[i]]++] = i;
+
+    for (int b = 0; b < qtd; b += LARGURA_SIMD)
+    {
+        int qtdLanes = qtd - b < LARGURA_SIMD ? qtd - b : LARGURA_SIMD;
+        resolveBloco(p, p->ordem + b, qtdLanes, inicio, xs, ys, tours, comprimentos, pesosMST);
+    }
+}
+
+// ------------------------------- Medição ------------------------------- //
+
+typedef struct
+{
+    int qtd;
+    const int *inicio;
+    const float *xs, *ys;
+    int *tours;
+    double *comprimentos, *pesosMST;
+} tTrabalhoPequenas;
+
+static void *trabalhadorPequenas(void *arg)
+{
+    tTrabalhoPequenas *t = (tTrabalhoPequenas *)arg;
+    tPequenas *pequenas = initPequenas();
+
+    resolvePequenas(pequenas, t->qtd, t->inicio, t->xs, t->ys, t->tours, t->comprimentos, t->pesosMST);
+
+    freePequenas(pequenas);
+    return NULL;
+}
+
+// Pipeline normal em uma instância: retorna o comprimento do tour e o peso da MST em *pesoMST
+static double resolveNormal(const float *xs, const float *ys, int n, double *pesoMST)
+{
+    tGrafo *grafo = initGrafo();
+    tVertice *vertice = initVertice(0, 0);
+    setSizeVertices(grafo, n);
+    for (int i = 0; i < n; i++)
+    {
+        reinitVertice(vertice, xs[i], ys[i]);
+        setVertice(grafo, i, vertice);
+    }
+    freeVertice(vertice);
+
+    initAllArestas(grafo);
+    sortArestas(grafo);
+    tAresta **MST = kruskalAlgorithm(grafo);
+
+    *pesoMST = 0;
+    for (int i = 0; i < n - 1; i++)
+        *pesoMST += getDist(MST[i]);
+
+    int *cidades = (int *)malloc(n * sizeof(int));
+    caminhamentoPreOrdem(MST, n, 0, cidades);
+
+    tVizinhos *vizinhos = initVizinhos(grafo, 10);
+    tTour *tour = initTour(n);
+    setCidadesTour(tour, cidades);
+    doisOpt(grafo, vizinhos, tour);
+    double comprimento = comprimentoTour(grafo, getCidadesTour(tour), n);
+
+    freeTour(tour);
+    freeVizinhos(vizinhos);
+    free(cidades);
+    freeMST(MST);
+    freeGrafo(grafo);
+
+    return comprimento;
+}
+
+void executaPequenas(int qtd, int threads, unsigned long long semente)
+{
+    tAleatorio *aleatorio = initAleatorio(semente);
+    int *inicio = (int *)malloc((qtd + 1) * sizeof(int));
+
+    inicio[0] = 0;
+    for (int i = 0; i < qtd; i++)
+        inicio[i + 1] = inicio[i] + MIN_VERTICES_TESTE +
+                        aleatorioIntervalo(aleatorio, MAX_VERTICES_TESTE - MIN_VERTICES_TESTE + 1);
+
+    int total = inicio[qtd];
+    float *xs = (float *)malloc(total * sizeof(float));
+    float *ys = (float *)malloc(total * sizeof(float));
+    int *tours = (int *)malloc(total * sizeof(int));
+    double *comprimentos = (double *)malloc(qtd * sizeof(double));
+    double *pesosMST = (double *)malloc(qtd * sizeof(double));
+
+    for (int i = 0; i < total; i++)
+    {
+        xs[i] = (float)(aleatorioReal(aleatorio) * 1000);
+        ys[i] = (float)(aleatorioReal(aleatorio) * 1000);
+    }
+    freeAleatorio(aleatorio);
+
+    printf("Instâncias: %d, de %d a %d vértices (%d vértices no total), lanes de %d\n", qtd, MIN_VERTICES_TESTE,
+           MAX_VERTICES_TESTE, total, LARGURA_SIMD);
+
+    // Em lote, dividido entre as threads
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    tTrabalhoPequenas *trabalhos = (tTrabalhoPequenas *)malloc(threads * sizeof(tTrabalhoPequenas));
+
+    double inicioTempo = agora();
+    for (int t = 0; t < threads; t++)
+    {
+        int a = (int)((long long)qtd * t / threads);
+        int b = (int)((long long)qtd * (t + 1) / threads);
+        trabalhos[t] = (tTrabalhoPequenas){b - a, inicio + a, xs, ys, tours, comprimentos + a, pesosMST + a};
+        pthread_create(&ids[t], NULL, trabalhadorPequenas, &trabalhos[t]);
+    }
+    for (int t = 0; t < threads; t++)
+        pthread_join(ids[t], NULL);
+    double tempoLote = agora() - inicioTempo;
+
+    free(ids);
+    free(trabalhos);
+
+    // Cada tour tem que ser uma permutação dos vértices da instância
+    int invalidos = 0;
+    char visto[MAX_VERTICES_PEQUENA];
+    for (int i = 0; i < qtd; i++)
+    {
+        int n = inicio[i + 1] - inicio[i];
+        memset(visto, 0, n);
+        for (int pos = 0; pos < n; pos++)
+        {
+            int v = tours[inicio[i] + pos];
+            if (v < 0 || v >= n || visto[v])
+            {
+                invalidos++;
+                break;
+            }
+            visto[v] = 1;
+        }
+    }
+
+    printf("Em lote: %.3f s (%.2f us por instância, %.0f instâncias por minuto, %d threads)\n", tempoLote,
+           1e6 * tempoLote / qtd, 60 * qtd / tempoLote, threads);
+    printf("Tours inválidos: %d\n", invalidos);
+
+    // Pipeline normal em um pedaço, para comparar
+    int referencia = qtd < MAX_REFERENCIA ? qtd : MAX_REFERENCIA;
+    double somaLote = 0, somaNormal = 0, maiorDiferenca = 0;
+
+    inicioTempo = agora();
+    for (int i = 0; i < referencia; i++)
+    {
+        double pesoNormal;
+        double comprimento = resolveNormal(xs + inicio[i], ys + inicio[i], inicio[i + 1] - inicio[i], &pesoNormal);
+        double diferenca = fabs(pesoNormal - pesosMST[i]) / pesoNormal;
+
+        somaNormal += comprimento;
+        somaLote += comprimentos[i];
+        if (diferenca > maiorDiferenca)
+            maiorDiferenca = diferenca;
+    }
+    double tempoNormal = agora() - inicioTempo;
+
+    if (referencia > 0)
+    {
+        printf("Pipeline normal (%d instâncias): %.3f s (%.2f us por instância)\n", referencia, tempoNormal,
+               1e6 * tempoNormal / referencia);
+        printf("Peso da MST: maior diferença relativa %.2e\n", maiorDiferenca);
+        printf("Comprimento médio do tour: %.2f em lote, %.2f no pipeline normal\n", somaLote / referencia,
+               somaNormal / referencia);
+    }
+
+    free(inicio);
+    free(xs);
+    free(ys);
+    free(tours);
+    free(comprimentos);
+    free(pesosMST);
+}
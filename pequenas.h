@@ -0,0 +1,61 @@
+#ifndef PEQUENAS_H
+#define PEQUENAS_H
+
+#define MAX_VERTICES_PEQUENA 64 // Maior instância aceita pelo resolvedor em lote
+
+typedef struct stPequenas tPequenas;
+
+/**
+ * @brief Cria o espaço de trabalho do resolvedor em lote
+ * @details Todo o espaço das instâncias é reservado aqui, de uma vez: resolver não faz
+ * nenhuma alocação por instância. Um espaço de trabalho por thread.
+ *
+ * @return tPequenas*
+ */
+tPequenas *initPequenas();
+
+/**
+ * @brief Destrói o espaço de trabalho
+ *
+ * @param pequenas Espaço a ser liberado
+ */
+void freePequenas(tPequenas *pequenas);
+
+/**
+ * @brief Resolve muitas instâncias pequenas (até MAX_VERTICES_PEQUENA vértices) de uma vez
+ * @details As instâncias são agrupadas por tamanho em blocos de LARGURA_SIMD e cada bloco é
+ * guardado como estrutura de vetores: a coordenada do vértice j de todas as instâncias do
+ * bloco fica lado a lado, e cada lane SIMD é uma instância. Por bloco: Prim denso (com a
+ * distância ao quadrado, que dá a mesma árvore), pré-ordem da MST e 2-opt de melhor melhoria
+ * sobre a vizinhança completa. Instâncias menores que o bloco são completadas com cópias da
+ * primeira cidade no fim do tour, que os movimentos nunca tocam.
+ * A instância i tem os vértices inicio[i] .. inicio[i + 1] - 1 de xs/ys, e o tour dela sai nas
+ * mesmas posições de tours, com índices locais (0 .. n - 1).
+ *
+ * @param pequenas Espaço de trabalho
+ * @param qtd Quantidade de instâncias
+ * @param inicio Vetor com qtd + 1 posições
+ * @param xs Coordenadas x de todas as instâncias, em sequência
+ * @param ys Coordenadas y de todas as instâncias, em sequência
+ * @param tours Saída, com inicio[qtd] posições
+ * @param comprimentos Saída, com qtd posições: comprimento de cada tour
+ * @param pesosMST Saída opcional (pode ser NULL), com qtd posições: peso de cada MST
+ * @pre 1 <= inicio[i + 1] - inicio[i] <= MAX_VERTICES_PEQUENA
+ */
+void resolvePequenas(tPequenas *pequenas, int qtd, const int *inicio, const float *xs, const float *ys, int *tours,
+                     double *comprimentos, double *pesosMST);
+
+/**
+ * @brief Mede a vazão do resolvedor em lote contra o pipeline normal (um tGrafo por instância)
+ * @details Gera qtd instâncias uniformes com 5 a 60 vértices e resolve todas em lote, dividido
+ * entre as threads. Um pedaço delas também passa pelo pipeline normal (initGrafo,
+ * initAllArestas, sortArestas, kruskalAlgorithm, pré-ordem e 2-opt com candidatos), para
+ * comparar tempo por instância, peso da MST e comprimento médio do tour.
+ *
+ * @param qtd Quantidade de instâncias
+ * @param threads Quantidade de threads
+ * @param semente Semente do gerador
+ */
+void executaPequenas(int qtd, int threads, unsigned long long semente);
+
+#endif
@@ -0,0 +1,345 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "saida.h"
+
+#define TAM_BUFFER_SAIDA (1 << 20)
+#define VERSAO_BINARIO 1
+#define TIPO_TOUR 0
+#define TIPO_MST 1
+
+struct stSaida
+{
+    FILE *arq;
+    char *buffer;
+    size_t qtd;
+    int erro;
+};
+
+// ------------------------- Inicialização ------------------------- //
+
+tSaida *initSaida(const char *caminho)
+{
+    FILE *arq = fopen(caminho, "wb");
+    if (!arq)
+        return NULL;
+
+    tSaida *saida = (tSaida *)malloc(sizeof(tSaida));
+    saida->arq = arq;
+    saida->buffer = (char *)malloc(TAM_BUFFER_SAIDA);
+    saida->qtd = 0;
+    saida->erro = 0;
+
+    return saida;
+}
+
+static void descarrega(tSaida *saida)
+{
+    if (saida->qtd && fwrite(saida->buffer, 1, saida->qtd, saida->arq) != saida->qtd)
+        saida->erro = 1;
+    saida->qtd = 0;
+}
+
+int fechaSaida(tSaida *saida)
+{
+    descarrega(saida);
+    if (fclose(saida->arq) != 0)
+        saida->erro = 1;
+
+    int ok = !saida->erro;
+    free(saida->buffer);
+    free(saida);
+
+    return ok;
+}
+
+// ---------------------------- Escrita ---------------------------- //
+
+// Garante espaço para tam bytes contíguos no buffer
+static char *reserva(tSaida *saida, size_t tam)
+{
+    if (saida->qtd + tam > TAM_BUFFER_SAIDA)
+        descarrega(saida);
+    return &(saida->buffer[saida->qtd]);
+}
+
+void escreveBytesSaida(tSaida *saida, const void *dados, size_t tam)
+{
+    // Blocos maiores que o buffer vão direto para o arquivo
+    if (tam > TAM_BUFFER_SAIDA)
+    {
+        descarrega(saida);
+        if (fwrite(dados, 1, tam, saida->arq) != tam)
+            saida->erro = 1;
+        return;
+    }
+
+    memcpy(reserva(saida, tam), dados, tam);
+    saida->qtd += tam;
+}
+
+void escreveTextoSaida(tSaida *saida, const char *texto)
+{
+    escreveBytesSaida(saida, texto, strlen(texto));
+}
+
+void escreveCharSaida(tSaida *saida, char c)
+{
+    *reserva(saida, 1) = c;
+    saida->qtd++;
+}
+
+void escreveInteiroSaida(tSaida *saida, long long valor)
+{
+    // 20 dígitos + sinal
+    char *p = reserva(saida, 21);
+    unsigned long long v = valor < 0 ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+    char digitos[20];
+    int qtd = 0;
+
+    do
+    {
+        digitos[qtd++] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+
+    if (valor < 0)
+        *p++ = '-';
+    while (qtd)
+        *p++ = digitos[--qtd];
+
+    saida->qtd = p - saida->buffer;
+}
+
+void escreveRealSaida(tSaida *saida, double valor)
+{
+    // "%f" de um double cabe em 309 dígitos inteiros, sinal, ponto, 6 decimais e o '\0'
+    char *p = reserva(saida, 320);
+    saida->qtd += snprintf(p, 320, "%f", valor);
+}
+
+// Varint (7 bits por byte, LSB primeiro) de um inteiro com sinal em zigzag
+static void escreveVarint(tSaida *saida, long long valor)
+{
+    unsigned long long z = ((unsigned long long)valor << 1) ^ (unsigned long long)(valor >> 63);
+    unsigned char *p = (unsigned char *)reserva(saida, 10);
+
+    while (z >= 0x80)
+    {
+        *p++ = (unsigned char)(z | 0x80);
+        z >>= 7;
+    }
+    *p++ = (unsigned char)z;
+
+    saida->qtd = (char *)p - saida->buffer;
+}
+
+// ----------------------------- Texto ----------------------------- //
+
+static void escreveCabecalho(tSaida *saida, const char *nome, const char *tipo, int dimensao, const char *secao)
+{
+    escreveTextoSaida(saida, "NAME: ");
+    escreveTextoSaida(saida, nome);
+    escreveTextoSaida(saida, "\nTYPE: ");
+    escreveTextoSaida(saida, tipo);
+    escreveTextoSaida(saida, "\nDIMENSION: ");
+    escreveInteiroSaida(saida, dimensao);
+    escreveCharSaida(saida, '\n');
+    escreveTextoSaida(saida, secao);
+    escreveCharSaida(saida, '\n');
+}
+
+int escreveMSTTexto(const char *caminho, const char *nome, tAresta **MST, int qtd, int dimensao)
+{
+    tSaida *saida = initSaida(caminho);
+    if (!saida)
+        return 0;
+
+    escreveCabecalho(saida, nome, "MST", dimensao, "MST_SECTION");
+    for (int i = 0; i < qtd; i++)
+    {
+        escreveInteiroSaida(saida, getV1(MST[i]) + 1);
+        escreveCharSaida(saida, ' ');
+        escreveInteiroSaida(saida, getV2(MST[i]) + 1);
+        escreveCharSaida(saida, '\n');
+    }
+    escreveTextoSaida(saida, "EOF\n");
+
+    return fechaSaida(saida);
+}
+
+int escreveTourTexto(const char *caminho, const char *nome, int *tour, int tam)
+{
+    tSaida *saida = initSaida(caminho);
+    if (!saida)
+        return 0;
+
+    escreveCabecalho(saida, nome, "TOUR", tam, "TOUR_SECTION");
+    for (int i = 0; i < tam; i++)
+    {
+        escreveInteiroSaida(saida, tour[i] + 1);
+        escreveCharSaida(saida, '\n');
+    }
+    escreveTextoSaida(saida, "EOF\n");
+
+    return fechaSaida(saida);
+}
+
+// ---------------------------- Binário ---------------------------- //
+
+static void escreve32(unsigned char *p, unsigned int v)
+{
+    for (int i = 0; i < 4; i++)
+        p[i] = (v >> (8 * i)) & 0xFF;
+}
+
+static unsigned int le32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static void escreveCabecalhoBinario(tSaida *saida, int tipo, int dimensao, int qtd)
+{
+    unsigned char cabecalho[16] = {'T', 'S', 'P', 'B', VERSAO_BINARIO, (unsigned char)tipo, 0, 0};
+
+    escreve32(cabecalho + 8, dimensao);
+    escreve32(cabecalho + 12, qtd);
+    escreveBytesSaida(saida, cabecalho, 16);
+}
+
+int escreveMSTBinario(const char *caminho, tAresta **MST, int qtd, int dimensao)
+{
+    tSaida *saida = initSaida(caminho);
+    if (!saida)
+        return 0;
+
+    escreveCabecalhoBinario(saida, TIPO_MST, dimensao, qtd);
+
+    long long anterior = 0;
+    for (int i = 0; i < qtd; i++)
+    {
+        long long v1 = getV1(MST[i]), v2 = getV2(MST[i]);
+        escreveVarint(saida, v1 - anterior);
+        escreveVarint(saida, v2 - v1);
+        anterior = v1;
+    }
+
+    return fechaSaida(saida);
+}
+
+int escreveTourBinario(const char *caminho, int *tour, int tam)
+{
+    tSaida *saida = initSaida(caminho);
+    if (!saida)
+        return 0;
+
+    escreveCabecalhoBinario(saida, TIPO_TOUR, tam, tam);
+
+    long long anterior = 0;
+    for (int i = 0; i < tam; i++)
+    {
+        escreveVarint(saida, tour[i] - anterior);
+        anterior = tour[i];
+    }
+
+    return fechaSaida(saida);
+}
+
+/**
+ * @brief Lê o arquivo binário inteiro e decodifica valoresPorItem varints por item
+ * @return long long* com os valores já sem o zigzag, ou NULL se o arquivo for inválido
+ */
+static long long *leBinario(const char *caminho, int tipo, int *qtd, int valoresPorItem)
+{
+    FILE *arq = fopen(caminho, "rb");
+    if (!arq)
+        return NULL;
+
+    fseek(arq, 0, SEEK_END);
+    long tam = ftell(arq);
+    fseek(arq, 0, SEEK_SET);
+
+    unsigned char *dados = (unsigned char *)malloc(tam > 0 ? tam : 1);
+    int lido = tam >= 16 && fread(dados, 1, tam, arq) == (size_t)tam;
+    fclose(arq);
+
+    if (!lido || memcmp(dados, "TSPB", 4) || dados[4] != VERSAO_BINARIO || dados[5] != tipo)
+    {
+        free(dados);
+        return NULL;
+    }
+
+    // Cada varint tem pelo menos um byte: quantidades maiores que o arquivo são inválidas
+    long long qtdValores = (long long)le32(dados + 12) * valoresPorItem;
+    if (qtdValores > tam - 16)
+    {
+        free(dados);
+        return NULL;
+    }
+
+    long long *valores = (long long *)malloc((qtdValores > 0 ? qtdValores : 1) * sizeof(long long));
+    long p = 16;
+
+    for (long long i = 0; i < qtdValores; i++)
+    {
+        unsigned long long z = 0;
+        int deslocamento = 0;
+
+        while (p < tam && dados[p] & 0x80 && deslocamento < 63)
+        {
+            z |= (unsigned long long)(dados[p++] & 0x7F) << deslocamento;
+            deslocamento += 7;
+        }
+        if (p >= tam)
+        {
+            free(valores);
+            free(dados);
+            return NULL;
+        }
+        z |= (unsigned long long)dados[p++] << deslocamento;
+
+        valores[i] = (long long)(z >> 1) ^ -(long long)(z & 1);
+    }
+
+    *qtd = (int)le32(dados + 12);
+    free(dados);
+
+    return valores;
+}
+
+int *leTourBinario(const char *caminho, int *tam)
+{
+    long long *deltas = leBinario(caminho, TIPO_TOUR, tam, 1);
+    if (!deltas)
+        return NULL;
+
+    int *tour = (int *)malloc((*tam > 0 ? *tam : 1) * sizeof(int));
+    long long atual = 0;
+    for (int i = 0; i < *tam; i++)
+    {
+        atual += deltas[i];
+        tour[i] = (int)atual;
+    }
+
+    free(deltas);
+    return tour;
+}
+
+int *leMSTBinario(const char *caminho, int *qtd)
+{
+    long long *deltas = leBinario(caminho, TIPO_MST, qtd, 2);
+    if (!deltas)
+        return NULL;
+
+    int *pares = (int *)malloc(2 * (*qtd > 0 ? *qtd : 1) * sizeof(int));
+    long long v1 = 0;
+    for (int i = 0; i < *qtd; i++)
+    {
+        v1 += deltas[2 * i];
+        pares[2 * i] = (int)v1;
+        pares[2 * i + 1] = (int)(v1 + deltas[2 * i + 1]);
+    }
+
+    free(deltas);
+    return pares;
+}
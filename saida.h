@@ -0,0 +1,142 @@
+#ifndef SAIDA_H
+#define SAIDA_H
+
+#include "grafo.h"
+
+typedef struct stSaida tSaida;
+
+// Funções inicializadoras e liberadoras
+
+/**
+ * @brief Abre um arquivo de saída com buffer próprio
+ * @details O texto é formatado direto no buffer (inteiros sem printf) e só vai para o
+ * arquivo quando o buffer enche ou no fechamento: um fwrite grande em vez de um fprintf
+ * por linha.
+ *
+ * @param caminho Arquivo a ser criado
+ * @return tSaida*, ou NULL se o arquivo não abrir
+ */
+tSaida *initSaida(const char *caminho);
+
+/**
+ * @brief Descarrega o buffer, fecha o arquivo e destrói a saída
+ *
+ * @param saida Saída a ser fechada
+ * @return int 1 se tudo foi gravado, 0 se houve erro
+ */
+int fechaSaida(tSaida *saida);
+
+// Funções gerais
+
+/**
+ * @brief Escreve uma string (sem formatação)
+ *
+ * @param saida Saída
+ * @param texto String terminada em '\0'
+ */
+void escreveTextoSaida(tSaida *saida, const char *texto);
+
+/**
+ * @brief Escreve um inteiro em decimal
+ *
+ * @param saida Saída
+ * @param valor Inteiro
+ */
+void escreveInteiroSaida(tSaida *saida, long long valor);
+
+/**
+ * @brief Escreve um real como o "%f" do printf
+ *
+ * @param saida Saída
+ * @param valor Real
+ */
+void escreveRealSaida(tSaida *saida, double valor);
+
+/**
+ * @brief Escreve um caractere
+ *
+ * @param saida Saída
+ * @param c Caractere
+ */
+void escreveCharSaida(tSaida *saida, char c);
+
+/**
+ * @brief Escreve bytes crus
+ *
+ * @param saida Saída
+ * @param dados Bytes
+ * @param tam Quantidade de bytes
+ */
+void escreveBytesSaida(tSaida *saida, const void *dados, size_t tam);
+
+// Arquivos .mst e .tour
+
+/**
+ * @brief Grava a MST no formato texto do TSPLIB (índices a partir de 1)
+ *
+ * @param caminho Arquivo .mst
+ * @param nome Nome da instância
+ * @param MST Vetor de arestas
+ * @param qtd Quantidade de arestas
+ * @param dimensao Quantidade de vértices
+ * @return int 1 se gravou, 0 se houve erro
+ */
+int escreveMSTTexto(const char *caminho, const char *nome, tAresta **MST, int qtd, int dimensao);
+
+/**
+ * @brief Grava o tour no formato texto do TSPLIB (índices a partir de 1)
+ *
+ * @param caminho Arquivo .tour
+ * @param nome Nome da instância
+ * @param tour Ordem de visita, índices a partir de 0
+ * @param tam Quantidade de cidades
+ * @return int 1 se gravou, 0 se houve erro
+ */
+int escreveTourTexto(const char *caminho, const char *nome, int *tour, int tam);
+
+/**
+ * @brief Grava a MST no formato binário
+ * @details Cabeçalho de 16 bytes ("TSPB", versão, tipo 1, dois bytes zerados, dimensão e
+ * quantidade em 32 bits little-endian), depois cada aresta como dois varints zigzag: a
+ * diferença de v1 para o v1 da aresta anterior e v2 - v1. Índices a partir de 0.
+ *
+ * @param caminho Arquivo de saída
+ * @param MST Vetor de arestas
+ * @param qtd Quantidade de arestas
+ * @param dimensao Quantidade de vértices
+ * @return int 1 se gravou, 0 se houve erro
+ */
+int escreveMSTBinario(const char *caminho, tAresta **MST, int qtd, int dimensao);
+
+/**
+ * @brief Grava o tour no formato binário
+ * @details Mesmo cabeçalho da MST (tipo 0), depois cada cidade como varint zigzag da
+ * diferença para a cidade anterior (a primeira é relativa a 0).
+ *
+ * @param caminho Arquivo de saída
+ * @param tour Ordem de visita, índices a partir de 0
+ * @param tam Quantidade de cidades
+ * @return int 1 se gravou, 0 se houve erro
+ */
+int escreveTourBinario(const char *caminho, int *tour, int tam);
+
+/**
+ * @brief Lê um tour gravado por escreveTourBinario
+ *
+ * @param caminho Arquivo de entrada
+ * @param tam Saída: quantidade de cidades
+ * @return int* Vetor com as cidades (liberar com free), ou NULL se o arquivo for inválido
+ */
+int *leTourBinario(const char *caminho, int *tam);
+
+/**
+ * @brief Lê uma MST gravada por escreveMSTBinario
+ *
+ * @param caminho Arquivo de entrada
+ * @param qtd Saída: quantidade de arestas
+ * @return int* Vetor com os pares v1 v2 (2 * qtd posições, liberar com free), ou NULL se o
+ * arquivo for inválido
+ */
+int *leMSTBinario(const char *caminho, int *qtd);
+
+#endif
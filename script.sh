@@ -1,4 +1,2 @@
-gcc main.c grafo.c UF.c -o prog -lm
-./prog
-./tsp_plot.py exemplos/in/pr1002.tsp exemplos/mst/pr1002.mst exemplos/opt/pr1002.opt.tour
-./tsp_plot.py exemplos/in/pr1002.tsp exemplos/out/pr1002.mst exemplos/out/pr1002.tour
\ No newline at end of file
+gcc -O2 main.c grafo.c UF.c aleatorio.c vizinhos.c tour.c multistart.c limite.c cache.c grade.c dinamico.c particao.c desenho.c saida.c gerador.c escala.c hilbert.c contador.c genetico.c christofides.c entrada.c pequenas.c janela.c lk.c tempo.c -o prog -lm -lpthread
+./prog pr1002 --desenho exemplos/out/pr1002.png --referencia
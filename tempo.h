@@ -0,0 +1,19 @@
+#ifndef TEMPO_H
+#define TEMPO_H
+
+/**
+ * @brief Tempo de relógio monotônico, em segundos
+ * @details Só diferenças entre duas chamadas têm sentido (o zero é arbitrário).
+ *
+ * @return double
+ */
+double agora();
+
+/**
+ * @brief Tempo de CPU do processo (soma de todas as threads), em segundos
+ *
+ * @return double
+ */
+double tempoCPU();
+
+#endif
@@ -0,0 +1,35 @@
+#!/bin/sh
+# Confere que --binario é sem perdas: .tourb e .mstb decodificados iguais às seções do .tour e .mst
+# Uso: ./testa_binario.sh [programa] (padrão: ./prog, compilado pelo script.sh)
+prog=${1:-./prog}
+tmp=$(mktemp -d)
+falhas=0
+
+# Linhas entre o *_SECTION e o EOF
+secao() {
+    sed -n '/_SECTION$/,/^EOF$/p' "$1" | sed '1d;$d'
+}
+
+for e in berlin52 eil101 tsp225 a280 pr1002; do
+    "$prog" "$e" --binario > /dev/null || { echo "$e: erro na execução"; falhas=$((falhas + 1)); continue; }
+
+    ok=1
+    for t in tour mst; do
+        secao "exemplos/out/$e.$t" > "$tmp/$e.$t"
+        if ! "$prog" --decodifica "exemplos/out/$e.${t}b" > "$tmp/$e.${t}b" ||
+            ! cmp -s "$tmp/$e.$t" "$tmp/$e.${t}b"; then
+            ok=0
+        fi
+    done
+    rm -f "exemplos/out/$e.tourb" "exemplos/out/$e.mstb"
+
+    if [ "$ok" -eq 1 ]; then
+        echo "$e: ok"
+    else
+        echo "$e: binário decodificado diferente do texto"
+        falhas=$((falhas + 1))
+    fi
+done
+
+rm -rf "$tmp"
+[ "$falhas" -eq 0 ]
@@ -0,0 +1,23 @@
+#!/bin/sh
+# Confere que --hilbert é transparente: .mst e .tour iguais byte a byte aos da execução sem ele
+# Uso: ./testa_hilbert.sh [programa] (padrão: ./prog, compilado pelo script.sh)
+prog=${1:-./prog}
+tmp=$(mktemp -d)
+falhas=0
+
+for e in berlin52 eil101 tsp225 a280 pr1002; do
+    "$prog" "$e" > /dev/null || { echo "$e: erro na execução"; falhas=$((falhas + 1)); continue; }
+    cp "exemplos/out/$e.mst" "exemplos/out/$e.tour" "$tmp/"
+
+    "$prog" "$e" --hilbert > /dev/null || { echo "$e: erro na execução com --hilbert"; falhas=$((falhas + 1)); continue; }
+
+    if cmp -s "$tmp/$e.mst" "exemplos/out/$e.mst" && cmp -s "$tmp/$e.tour" "exemplos/out/$e.tour"; then
+        echo "$e: ok"
+    else
+        echo "$e: saída diferente com --hilbert"
+        falhas=$((falhas + 1))
+    fi
+done
+
+rm -rf "$tmp"
+[ "$falhas" -eq 0 ]
@@ -0,0 +1,536 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tour.h"
+
+#define MAX_SEGMENTO_PERTURBACAO 50
+
+// Troca 2-opt registrada: saíram (a, b) e (c, d), entraram (a, c) e (b, d)
+typedef struct
+{
+    int a, b, c, d;
+} tTroca;
+
+struct stTour
+{
+    int tam;
+    int *cidades; // Ordem de visita
+    int *pos;     // pos[cidade] == posição da cidade em cidades
+
+    // Fila circular de cidades ativas (don't-look bits)
+    int *fila;
+    char *naFila;
+    int inicioFila;
+    int qtdFila;
+
+    int *aux; // Espaço temporário da perturbação
+
+    // Registro de trocas (desligado por padrão), para desfazer movimentos em sequência
+    int registra;
+    tTroca *registro;
+    int qtdRegistro, capRegistro;
+};
+
+// ---------------------------- Construção ---------------------------- //
+
+// Insere um elemento se ele ainda não estiver no vetor
+static int insereVetor(int *vetor, int N, int elem, int pos)
+{
+    for (int i = 0; i < pos; i++)
+    {
+        if (vetor[i] == elem)
+        {
+            return 0;
+        }
+    }
+    vetor[pos] = elem;
+    return 1;
+}
+
+void caminhamentoMST(tAresta **MST, int tam, int *tour)
+{
+    int insert_pos = 0;
+
+    insereVetor(tour, tam, getV1(MST[0]), insert_pos);
+    insert_pos++;
+    insereVetor(tour, tam, getV2(MST[0]), insert_pos);
+    insert_pos++;
+    incPercorrida(MST[0]);
+    int vertAtual = getV2(MST[0]);
+    int flag_continuar_caminhamento = 1;
+    int i = 1;
+
+    while (!todoPercorrido(MST, tam - 1) && flag_continuar_caminhamento)
+    {
+        for (; i < tam - 1; i++)
+        {
+            // Para cada aresta
+            if (getPercorrida(MST[i]) < 2)
+            {
+                int v1 = getV1(MST[i]);
+                int v2 = getV2(MST[i]);
+
+                if (vertAtual == v1)
+                {
+                    if (insereVetor(tour, tam, v2, insert_pos))
+                        insert_pos++;
+                    if (insert_pos == tam)
+                    {
+                        flag_continuar_caminhamento = 0;
+                        break;
+                    }
+                    vertAtual = v2;
+                    incPercorrida(MST[i]);
+                }
+                else if (vertAtual == v2)
+                {
+                    if (insereVetor(tour, tam, v1, insert_pos))
+                        insert_pos++;
+                    if (insert_pos == tam)
+                    {
+                        flag_continuar_caminhamento = 0;
+                        break;
+                    }
+                    vertAtual = v1;
+                    incPercorrida(MST[i]);
+                }
+            }
+        }
+        i = 0;
+    }
+}
+
+void caminhamentoPreOrdem(tAresta **MST, int tam, int raiz, int *tour)
+{
+    // Lista de adjacência compacta: adj[inicio[v] .. inicio[v + 1] - 1] são os vizinhos de v
+    int *inicio = (int *)calloc(tam + 1, sizeof(int));
+    int *adj = (int *)malloc(2 * (tam - 1 > 0 ? tam - 1 : 1) * sizeof(int));
+    int *pilha = (int *)malloc(2 * tam * sizeof(int));
+    char *visitado = (char *)calloc(tam, sizeof(char));
+
+    for (int i = 0; i < tam - 1; i++)
+    {
+        inicio[getV1(MST[i]) + 1]++;
+        inicio[getV2(MST[i]) + 1]++;
+    }
+    for (int v = 0; v < tam; v++)
+        inicio[v + 1] += inicio[v];
+
+    int *proximo = (int *)malloc(tam * sizeof(int));
+    memcpy(proximo, inicio, tam * sizeof(int));
+    for (int i = 0; i < tam - 1; i++)
+    {
+        int v1 = getV1(MST[i]);
+        int v2 = getV2(MST[i]);
+        adj[proximo[v1]++] = v2;
+        adj[proximo[v2]++] = v1;
+    }
+    free(proximo);
+
+    int topo = 0, qtd = 0;
+    pilha[topo++] = raiz;
+
+    while (topo > 0)
+    {
+        int v = pilha[--topo];
+        if (visitado[v])
+            continue;
+
+        visitado[v] = 1;
+        tour[qtd++] = v;
+
+        // Empilha ao contrário para visitar os filhos na ordem da lista
+        for (int p = inicio[v + 1] - 1; p >= inicio[v]; p--)
+        {
+            if (!visitado[adj[p]])
+                pilha[topo++] = adj[p];
+        }
+    }
+
+    free(inicio);
+    free(adj);
+    free(pilha);
+    free(visitado);
+}
+
+double comprimentoTour(tGrafo *grafo, int *cidades, int tam)
+{
+    double comprimento = 0;
+
+    for (int i = 0; i < tam; i++)
+        comprimento += distVertices(grafo, cidades[i], cidades[(i + 1) % tam]);
+
+    return comprimento;
+}
+
+unsigned long long chaveComprimento(double comprimento, int id)
+{
+    float c = (float)comprimento;
+    unsigned int bits;
+
+    memcpy(&bits, &c, sizeof(bits));
+
+    return ((unsigned long long)bits << 32) | (unsigned int)id;
+}
+
+double comprimentoChave(unsigned long long chave)
+{
+    unsigned int bits = (unsigned int)(chave >> 32);
+    float c;
+
+    memcpy(&c, &bits, sizeof(c));
+
+    return c;
+}
+
+int *leTour(const char *caminho, int tam)
+{
+    FILE *arq = fopen(caminho, "r");
+    if (!arq)
+        return NULL;
+
+    // Pula o cabeçalho até a seção do tour
+    char linha[256];
+    while (fgets(linha, sizeof(linha), arq) && !strstr(linha, "TOUR_SECTION"))
+        ;
+
+    int *tour = (int *)malloc((tam > 0 ? tam : 1) * sizeof(int));
+    int qtd = 0, cidade;
+
+    while (qtd < tam && fscanf(arq, "%d", &cidade) == 1 && cidade != -1)
+    {
+        if (cidade < 1 || cidade > tam)
+            break;
+        tour[qtd++] = cidade - 1;
+    }
+    fclose(arq);
+
+    if (qtd != tam)
+    {
+        free(tour);
+        return NULL;
+    }
+
+    return tour;
+}
+
+// ------------------------------ tTour ------------------------------ //
+
+tTour *initTour(int tam)
+{
+    tTour *tour = (tTour *)malloc(sizeof(tTour));
+
+    tour->tam = tam;
+    tour->cidades = (int *)malloc(tam * sizeof(int));
+    tour->pos = (int *)malloc(tam * sizeof(int));
+    tour->fila = (int *)malloc(tam * sizeof(int));
+    tour->naFila = (char *)calloc(tam, sizeof(char));
+    tour->aux = (int *)malloc(2 * MAX_SEGMENTO_PERTURBACAO * sizeof(int));
+    tour->inicioFila = 0;
+    tour->qtdFila = 0;
+    tour->registra = 0;
+    tour->registro = NULL;
+    tour->qtdRegistro = tour->capRegistro = 0;
+
+    return tour;
+}
+
+void freeTour(tTour *tour)
+{
+    free(tour->cidades);
+    free(tour->pos);
+    free(tour->fila);
+    free(tour->naFila);
+    free(tour->aux);
+    free(tour->registro);
+    free(tour);
+}
+
+void setCidadesTour(tTour *tour, int *cidades)
+{
+    memcpy(tour->cidades, cidades, tour->tam * sizeof(int));
+
+    for (int i = 0; i < tour->tam; i++)
+    {
+        tour->pos[cidades[i]] = i;
+        ativaCidadeTour(tour, cidades[i]);
+    }
+}
+
+int *getCidadesTour(tTour *tour)
+{
+    return tour->cidades;
+}
+
+void copiaTour(tTour *destino, tTour *origem)
+{
+    memcpy(destino->cidades, origem->cidades, origem->tam * sizeof(int));
+    memcpy(destino->pos, origem->pos, origem->tam * sizeof(int));
+}
+
+void ativaCidadeTour(tTour *tour, int cidade)
+{
+    if (tour->naFila[cidade])
+        return;
+
+    tour->naFila[cidade] = 1;
+    tour->fila[(tour->inicioFila + tour->qtdFila) % tour->tam] = cidade;
+    tour->qtdFila++;
+}
+
+static int retiraCidadeAtiva(tTour *tour)
+{
+    int cidade = tour->fila[tour->inicioFila];
+
+    tour->inicioFila = (tour->inicioFila + 1) % tour->tam;
+    tour->qtdFila--;
+    tour->naFila[cidade] = 0;
+
+    return cidade;
+}
+
+void desativaCidadesTour(tTour *tour)
+{
+    while (tour->qtdFila > 0)
+        retiraCidadeAtiva(tour);
+}
+
+int retiraCidadeAtivaTour(tTour *tour)
+{
+    return tour->qtdFila > 0 ? retiraCidadeAtiva(tour) : -1;
+}
+
+static int sucessor(tTour *tour, int cidade)
+{
+    int p = tour->pos[cidade] + 1;
+    return tour->cidades[p == tour->tam ? 0 : p];
+}
+
+static int antecessor(tTour *tour, int cidade)
+{
+    int p = tour->pos[cidade] - 1;
+    return tour->cidades[p < 0 ? tour->tam - 1 : p];
+}
+
+/**
+ * @brief Inverte as posições i..j (circular) do tour
+ * @details Inverter o complemento dá o mesmo ciclo, então inverte o lado mais curto.
+ */
+static void inverteTrecho(tTour *tour, int i, int j)
+{
+    int n = tour->tam;
+    int tamTrecho = ((j - i + n) % n) + 1;
+
+    if (2 * tamTrecho > n)
+    {
+        int aux = i;
+        i = (j + 1) % n;
+        j = (aux - 1 + n) % n;
+        tamTrecho = n - tamTrecho;
+    }
+
+    for (int k = 0; k < tamTrecho / 2; k++)
+    {
+        int ci = tour->cidades[i];
+        int cj = tour->cidades[j];
+
+        tour->cidades[i] = cj;
+        tour->pos[cj] = i;
+        tour->cidades[j] = ci;
+        tour->pos[ci] = j;
+
+        i = i + 1 == n ? 0 : i + 1;
+        j = j == 0 ? n - 1 : j - 1;
+    }
+}
+
+int sucessorTour(tTour *tour, int cidade)
+{
+    return sucessor(tour, cidade);
+}
+
+int antecessorTour(tTour *tour, int cidade)
+{
+    return antecessor(tour, cidade);
+}
+
+int entreTour(tTour *tour, int a, int b, int c)
+{
+    int n = tour->tam;
+    int ab = tour->pos[b] - tour->pos[a];
+    int ac = tour->pos[c] - tour->pos[a];
+
+    return (ab < 0 ? ab + n : ab) <= (ac < 0 ? ac + n : ac);
+}
+
+// Tira (a, b) e (c, d), põe (a, c) e (b, d); b vem depois de a (d depois de c) num dos sentidos
+static void aplicaTroca(tTour *tour, int a, int b, int c)
+{
+    if (sucessor(tour, a) == b)
+        inverteTrecho(tour, tour->pos[b], tour->pos[c]);
+    else
+        inverteTrecho(tour, tour->pos[c], tour->pos[b]);
+}
+
+static void registraTroca(tTour *tour, int a, int b, int c, int d)
+{
+    if (!tour->registra)
+        return;
+
+    if (tour->qtdRegistro == tour->capRegistro)
+    {
+        tour->capRegistro = tour->capRegistro ? 2 * tour->capRegistro : 1024;
+        tour->registro = (tTroca *)realloc(tour->registro, tour->capRegistro * sizeof(tTroca));
+    }
+    tour->registro[tour->qtdRegistro++] = (tTroca){a, b, c, d};
+}
+
+void trocaTour(tTour *tour, int a, int b, int c, int d)
+{
+    aplicaTroca(tour, a, b, c);
+    registraTroca(tour, a, b, c, d);
+}
+
+void registraTrocasTour(tTour *tour, int liga)
+{
+    tour->registra = liga;
+    tour->qtdRegistro = 0;
+}
+
+int getMarcaTour(tTour *tour)
+{
+    return tour->qtdRegistro;
+}
+
+void desfazTrocasTour(tTour *tour, int marca)
+{
+    // Depois da troca, c vem depois de a e d depois de b: a troca com (a, c) e (b, d) desfaz
+    while (tour->qtdRegistro > marca)
+    {
+        tTroca *t = &(tour->registro[--tour->qtdRegistro]);
+        aplicaTroca(tour, t->a, t->c, t->b);
+    }
+}
+
+void ativaTrocasTour(tTour *tour, int marca)
+{
+    for (int i = marca; i < tour->qtdRegistro; i++)
+    {
+        ativaCidadeTour(tour, tour->registro[i].a);
+        ativaCidadeTour(tour, tour->registro[i].b);
+        ativaCidadeTour(tour, tour->registro[i].c);
+        ativaCidadeTour(tour, tour->registro[i].d);
+    }
+}
+
+double doisOpt(tGrafo *grafo, tVizinhos *vizinhos, tTour *tour)
+{
+    double ganho = 0;
+    int k = getQtdVizinhos(vizinhos);
+
+    if (tour->tam < 4)
+    {
+        desativaCidadesTour(tour);
+        return 0;
+    }
+
+    while (tour->qtdFila > 0)
+    {
+        int a = retiraCidadeAtiva(tour);
+        int melhorou = 0;
+
+        // direcao 0: aresta (a, suc(a)); direcao 1: aresta (ant(a), a)
+        for (int direcao = 0; direcao < 2 && !melhorou; direcao++)
+        {
+            int b = direcao == 0 ? sucessor(tour, a) : antecessor(tour, a);
+            float dab = distVertices(grafo, a, b);
+            int *lista = getVizinhos(vizinhos, a);
+
+            for (int v = 0; v < k; v++)
+            {
+                int c = lista[v];
+                float dac = distVertices(grafo, a, c);
+
+                // Lista ordenada: daqui em diante nenhuma troca tem ganho parcial positivo
+                if (dac >= dab)
+                    break;
+
+                int d = direcao == 0 ? sucessor(tour, c) : antecessor(tour, c);
+                if (c == b || d == a)
+                    continue;
+
+                float delta = dac + distVertices(grafo, b, d) - dab - distVertices(grafo, c, d);
+                if (delta < -1e-4f)
+                {
+                    // Troca (a,b),(c,d) por (a,c),(b,d)
+                    if (direcao == 0)
+                        inverteTrecho(tour, tour->pos[b], tour->pos[c]);
+                    else
+                        inverteTrecho(tour, tour->pos[a], tour->pos[d]);
+
+                    ganho -= delta;
+                    ativaCidadeTour(tour, a);
+                    ativaCidadeTour(tour, b);
+                    ativaCidadeTour(tour, c);
+                    ativaCidadeTour(tour, d);
+                    melhorou = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    return ganho;
+}
+
+double doubleBridge(tGrafo *grafo, tTour *tour, tAleatorio *aleatorio)
+{
+    int n = tour->tam;
+    int limite = n / 3 < MAX_SEGMENTO_PERTURBACAO ? n / 3 : MAX_SEGMENTO_PERTURBACAO;
+
+    // A termina em p; B = p+1 .. p+l1; C = p+l1+1 .. p+l1+l2; D começa depois
+    int p = aleatorioIntervalo(aleatorio, n);
+    int l1 = 1 + aleatorioIntervalo(aleatorio, limite);
+    int l2 = 1 + aleatorioIntervalo(aleatorio, limite);
+
+    int a = tour->cidades[p];
+    int b0 = tour->cidades[(p + 1) % n];
+    int b1 = tour->cidades[(p + l1) % n];
+    int c0 = tour->cidades[(p + l1 + 1) % n];
+    int c1 = tour->cidades[(p + l1 + l2) % n];
+    int d = tour->cidades[(p + l1 + l2 + 1) % n];
+
+    double delta = distVertices(grafo, a, c0) + distVertices(grafo, c1, b0) + distVertices(grafo, b1, d) -
+                   distVertices(grafo, a, b0) - distVertices(grafo, b1, c0) - distVertices(grafo, c1, d);
+
+    // Reescreve B C como C B
+    for (int i = 0; i < l1 + l2; i++)
+        tour->aux[i] = tour->cidades[(p + 1 + i) % n];
+
+    for (int i = 0; i < l2; i++)
+    {
+        int q = (p + 1 + i) % n;
+        tour->cidades[q] = tour->aux[l1 + i];
+        tour->pos[tour->cidades[q]] = q;
+    }
+    for (int i = 0; i < l1; i++)
+    {
+        int q = (p + 1 + l2 + i) % n;
+        tour->cidades[q] = tour->aux[i];
+        tour->pos[tour->cidades[q]] = q;
+    }
+
+    // Para o registro, as três trocas 2-opt que levam ao mesmo ciclo
+    registraTroca(tour, a, b0, c1, d);
+    registraTroca(tour, a, c1, c0, b1);
+    registraTroca(tour, c1, b1, b0, d);
+
+    ativaCidadeTour(tour, a);
+    ativaCidadeTour(tour, b0);
+    ativaCidadeTour(tour, b1);
+    ativaCidadeTour(tour, c0);
+    ativaCidadeTour(tour, c1);
+    ativaCidadeTour(tour, d);
+
+    return delta;
+}
@@ -0,0 +1,248 @@
+#ifndef TOUR_H
+#define TOUR_H
+
+#include "grafo.h"
+#include "vizinhos.h"
+#include "aleatorio.h"
+
+typedef struct stTour tTour;
+
+// Funções de construção (não precisam de tTour)
+
+/**
+ * @brief Gera o tour caminhando pelas arestas da MST, na ordem em que o Kruskal as escolheu
+ * @details É o caminhamento original do programa: a saída padrão depende dele.
+ *
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param tam Quantidade de vértices
+ * @param tour Vetor de saída, com tam posições
+ */
+void caminhamentoMST(tAresta **MST, int tam, int *tour);
+
+/**
+ * @brief Gera o tour por uma busca em profundidade (pré-ordem) na MST a partir de uma raiz
+ * @details Com raízes diferentes saem tours diferentes, todos com garantia de 2-aproximação.
+ *
+ * @param MST Vetor com as Qtd_vértices - 1 arestas da MST
+ * @param tam Quantidade de vértices
+ * @param raiz Índice do vértice inicial
+ * @param tour Vetor de saída, com tam posições
+ */
+void caminhamentoPreOrdem(tAresta **MST, int tam, int raiz, int *tour);
+
+/**
+ * @brief Calcula o comprimento do ciclo (incluindo a volta ao primeiro vértice)
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param cidades Ordem de visita
+ * @param tam Quantidade de cidades
+ * @return double
+ */
+double comprimentoTour(tGrafo *grafo, int *cidades, int tam);
+
+/**
+ * @brief Monta a chave de 64 bits que compara tours pelo comprimento
+ * @details Para floats positivos, a ordem dos bits é a mesma ordem dos valores. Assim a chave
+ * (comprimento em float nos 32 bits de cima, id embaixo) compara primeiro o comprimento e
+ * desempata pelo id; serve para escolher o melhor entre threads com um compare-and-swap.
+ *
+ * @param comprimento Comprimento do tour (positivo)
+ * @param id Desempate (ex.: número da partida ou da ilha)
+ * @return unsigned long long
+ */
+unsigned long long chaveComprimento(double comprimento, int id);
+
+/**
+ * @brief Recupera o comprimento (em precisão float) guardado numa chave de chaveComprimento
+ *
+ * @param chave Chave
+ * @return double
+ */
+double comprimentoChave(unsigned long long chave);
+
+/**
+ * @brief Lê um arquivo .tour (formato TSPLIB, como os de exemplos/opt)
+ * @details Os índices do arquivo começam em 1 e são devolvidos a partir de 0. A leitura para
+ * no -1, no EOF ou depois de tam cidades.
+ *
+ * @param caminho Caminho do arquivo
+ * @param tam Quantidade de cidades esperada
+ * @return int* Vetor com tam posições (liberar com free), ou NULL se o arquivo não existir ou
+ * não tiver tam cidades válidas
+ */
+int *leTour(const char *caminho, int tam);
+
+// Funções inicializadoras e liberadoras
+
+/**
+ * @brief Cria um tTour vazio, com espaço para tam cidades
+ * @details Além da ordem, guarda a posição de cada cidade e a fila de cidades "ativas"
+ * (don't-look bits) usada pela busca local.
+ *
+ * @param tam Quantidade de cidades
+ * @return tTour*
+ */
+tTour *initTour(int tam);
+
+/**
+ * @brief Destrói o tour
+ *
+ * @param tour Tour a ser liberado
+ */
+void freeTour(tTour *tour);
+
+// Funções gerais
+
+/**
+ * @brief Copia a ordem das cidades para dentro do tour e ativa todas elas
+ *
+ * @param tour Tour a ser modificado
+ * @param cidades Vetor com uma permutação de 0..tam-1
+ */
+void setCidadesTour(tTour *tour, int *cidades);
+
+/**
+ * @brief Pega a ordem das cidades
+ * @details O vetor pertence ao tour e é alterado pelas buscas locais.
+ *
+ * @param tour Tour
+ * @return int*
+ */
+int *getCidadesTour(tTour *tour);
+
+/**
+ * @brief Copia ordem e posições de um tour para outro de mesmo tamanho
+ * @details A fila de cidades ativas não é copiada.
+ *
+ * @param destino Tour a ser sobrescrito
+ * @param origem Tour copiado
+ */
+void copiaTour(tTour *destino, tTour *origem);
+
+/**
+ * @brief Coloca a cidade na fila de cidades a serem examinadas pela busca local
+ *
+ * @param tour Tour
+ * @param cidade Índice da cidade
+ */
+void ativaCidadeTour(tTour *tour, int cidade);
+
+/**
+ * @brief Esvazia a fila de cidades ativas
+ * @details Útil para depois ativar só uma parte das cidades (ex.: as de fronteira).
+ *
+ * @param tour Tour
+ */
+void desativaCidadesTour(tTour *tour);
+
+/**
+ * @brief Tira a próxima cidade da fila de cidades ativas
+ *
+ * @param tour Tour
+ * @return Índice da cidade, ou -1 se a fila estiver vazia
+ */
+int retiraCidadeAtivaTour(tTour *tour);
+
+/**
+ * @brief Pega a cidade seguinte no sentido do vetor (O(1))
+ *
+ * @param tour Tour
+ * @param cidade Índice da cidade
+ * @return int
+ */
+int sucessorTour(tTour *tour, int cidade);
+
+/**
+ * @brief Pega a cidade anterior no sentido do vetor (O(1))
+ *
+ * @param tour Tour
+ * @param cidade Índice da cidade
+ * @return int
+ */
+int antecessorTour(tTour *tour, int cidade);
+
+/**
+ * @brief Diz se b está no caminho de a até c, andando no sentido do vetor (O(1), pelas posições)
+ * @details Para o sentido contrário, basta trocar a e c.
+ *
+ * @param tour Tour
+ * @param a Início do caminho
+ * @param b Cidade consultada
+ * @param c Fim do caminho
+ * @return 1 se a, b, c aparecem nessa ordem (b pode ser a ou c), 0 se não
+ */
+int entreTour(tTour *tour, int a, int b, int c);
+
+/**
+ * @brief Troca 2-opt: tira (a, b) e (c, d) e põe (a, c) e (b, d)
+ * @details b vem logo depois de a e d logo depois de c, os dois no mesmo sentido (qualquer um).
+ * Inverte o lado mais curto do tour, então o sentido do vetor pode mudar. Entra no registro,
+ * se ele estiver ligado.
+ *
+ * @param tour Tour
+ * @param a Cidade
+ * @param b Vizinha de a
+ * @param c Cidade
+ * @param d Vizinha de c, do mesmo lado que b está de a
+ */
+void trocaTour(tTour *tour, int a, int b, int c, int d);
+
+/**
+ * @brief Liga (ou desliga) o registro de trocas e o esvazia
+ * @details Com ele ligado, trocaTour e doubleBridge guardam cada troca, e desfazTrocasTour volta
+ * o ciclo ao que era numa marca, sem copiar o tour. As trocas do doisOpt não entram.
+ *
+ * @param tour Tour
+ * @param liga 1 para ligar, 0 para desligar
+ */
+void registraTrocasTour(tTour *tour, int liga);
+
+/**
+ * @brief Pega a marca atual do registro (quantas trocas ele tem)
+ *
+ * @param tour Tour
+ * @return int
+ */
+int getMarcaTour(tTour *tour);
+
+/**
+ * @brief Desfaz as trocas registradas depois da marca, da última para a primeira
+ * @details Volta o mesmo ciclo, não necessariamente o mesmo vetor (pode sair invertido).
+ *
+ * @param tour Tour
+ * @param marca Valor de getMarcaTour
+ */
+void desfazTrocasTour(tTour *tour, int marca);
+
+/**
+ * @brief Ativa as pontas de todas as trocas registradas depois da marca
+ *
+ * @param tour Tour
+ * @param marca Valor de getMarcaTour
+ */
+void ativaTrocasTour(tTour *tour, int marca);
+
+/**
+ * @brief Busca local 2-opt restrita às listas de candidatos
+ * @details Só examina as cidades ativas, e ativa as pontas de cada troca feita.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param vizinhos Listas de candidatos
+ * @param tour Tour a ser melhorado
+ * @return Quanto o comprimento diminuiu
+ */
+double doisOpt(tGrafo *grafo, tVizinhos *vizinhos, tTour *tour);
+
+/**
+ * @brief Aplica uma perturbação double-bridge em um trecho curto e aleatório do tour
+ * @details Troca dois segmentos consecutivos de lugar (A B C D -> A C B D) e ativa as pontas.
+ *
+ * @param grafo Grafo com o vetor de vértices
+ * @param tour Tour a ser perturbado
+ * @param aleatorio Gerador usado no sorteio
+ * @pre O tour tem pelo menos 8 cidades
+ * @return Quanto o comprimento aumentou
+ */
+double doubleBridge(tGrafo *grafo, tTour *tour, tAleatorio *aleatorio);
+
+#endif
@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "vizinhos.h"
+
+struct stVizinhos
+{
+    int *lista; // Qtd_vértices * k índices, k por vértice
+
+    int k;
+    int tam; // Quantidade de vértices
+};
+
+// Grade uniforme usada só durante a construção das listas
+typedef struct
+{
+    float minX, minY;
+    float tamCelula;
+    int colunas, linhas;
+
+    int *inicio; // inicio[c] .. inicio[c + 1] - 1 são as posições da célula c em pontos
+    int *pontos; // Índices dos vértices agrupados por célula
+} tGrade;
+
+static int celulaCoord(float valor, float minimo, float tamCelula, int limite)
+{
+    int c = (int)((valor - minimo) / tamCelula);
+
+    if (c < 0)
+        return 0;
+    if (c >= limite)
+        return limite - 1;
+    return c;
+}
+
+static void montaGrade(tGrade *grade, const float *xs, const float *ys, int n)
+{
+    // Sem pontos: uma célula vazia, sem ler xs[0]
+    if (n < 1)
+    {
+        grade->minX = grade->minY = 0;
+        grade->tamCelula = 1;
+        grade->colunas = grade->linhas = 1;
+        grade->inicio = (int *)calloc(2, sizeof(int));
+        grade->pontos = NULL;
+        return;
+    }
+
+    float maxX = xs[0], maxY = ys[0];
+    grade->minX = xs[0];
+    grade->minY = ys[0];
+
+    for (int i = 1; i < n; i++)
+    {
+        if (xs[i] < grade->minX)
+            grade->minX = xs[i];
+        if (xs[i] > maxX)
+            maxX = xs[i];
+        if (ys[i] < grade->minY)
+            grade->minY = ys[i];
+        if (ys[i] > maxY)
+            maxY = ys[i];
+    }
+
+    // Em média, 2 pontos por célula
+    float largura = maxX - grade->minX;
+    float altura = maxY - grade->minY;
+    float lado = largura > altura ? largura : altura;
+    int divisoes = (int)ceil(sqrt(n / 2.0));
+
+    grade->tamCelula = divisoes > 0 && lado > 0 ? lado / divisoes : 1;
+    grade->colunas = (int)(largura / grade->tamCelula) + 1;
+    grade->linhas = (int)(altura / grade->tamCelula) + 1;
+
+    int qtdCelulas = grade->colunas * grade->linhas;
+    grade->inicio = (int *)calloc(qtdCelulas + 1, sizeof(int));
+    grade->pontos = (int *)malloc(n * sizeof(int));
+    int *celulaDe = (int *)malloc(n * sizeof(int));
+
+    // Counting sort dos vértices pela célula
+    for (int i = 0; i < n; i++)
+    {
+        int cx = celulaCoord(xs[i], grade->minX, grade->tamCelula, grade->colunas);
+        int cy = celulaCoord(ys[i], grade->minY, grade->tamCelula, grade->linhas);
+        celulaDe[i] = cy * grade->colunas + cx;
+        grade->inicio[celulaDe[i] + 1]++;
+    }
+
+    for (int c = 0; c < qtdCelulas; c++)
+        grade->inicio[c + 1] += grade->inicio[c];
+
+    int *proximo = (int *)malloc(qtdCelulas * sizeof(int));
+    for (int c = 0; c < qtdCelulas; c++)
+        proximo[c] = grade->inicio[c];
+
+    for (int i = 0; i < n; i++)
+        grade->pontos[proximo[celulaDe[i]]++] = i;
+
+    free(proximo);
+    free(celulaDe);
+}
+
+/**
+ * @brief Tenta colocar o vértice j entre os k melhores de i (inserção ordenada)
+ *
+ * @return Nova quantidade de candidatos
+ */
+static int insereCandidato(int *melhores, float *dists, int qtd, int k, int j, float d)
+{
+    if (qtd == k && d >= dists[k - 1])
+        return qtd;
+
+    int p = qtd < k ? qtd++ : k - 1;
+    while (p > 0 && dists[p - 1] > d)
+    {
+        melhores[p] = melhores[p - 1];
+        dists[p] = dists[p - 1];
+        p--;
+    }
+    melhores[p] = j;
+    dists[p] = d;
+
+    return qtd;
+}
+
+tVizinhos *initVizinhos(tGrafo *grafo, int k)
+{
+    int n = getSizeVertices(grafo);
+
+    if (k > n - 1)
+        k = n - 1;
+    if (k < 0)
+        k = 0;
+
+    tVizinhos *vizinhos = (tVizinhos *)malloc(sizeof(tVizinhos));
+    vizinhos->k = k;
+    vizinhos->tam = n;
+    vizinhos->lista = (int *)malloc((size_t)n * (k > 0 ? k : 1) * sizeof(int));
+
+    if (k == 0)
+        return vizinhos;
+
+    // Copia as coordenadas para vetores contíguos: a busca toca muito nelas
+    float *xs = (float *)malloc(n * sizeof(float));
+    float *ys = (float *)malloc(n * sizeof(float));
+    for (int i = 0; i < n; i++)
+    {
+        tVertice *v = getVertice(grafo, i);
+        xs[i] = getX(v);
+        ys[i] = getY(v);
+    }
+
+    tGrade grade;
+    montaGrade(&grade, xs, ys, n);
+
+    float *dists = (float *)malloc(k * sizeof(float));
+    int maxAnel = grade.colunas > grade.linhas ? grade.colunas : grade.linhas;
+
+    for (int i = 0; i < n; i++)
+    {
+        int *melhores = &(vizinhos->lista[(size_t)i * k]);
+        int qtd = 0;
+        int cx = celulaCoord(xs[i], grade.minX, grade.tamCelula, grade.colunas);
+        int cy = celulaCoord(ys[i], grade.minY, grade.tamCelula, grade.linhas);
+
+        // Percorre anéis de células cada vez mais distantes
+        for (int anel = 0; anel <= maxAnel; anel++)
+        {
+            for (int y = cy - anel; y <= cy + anel; y++)
+            {
+                if (y < 0 || y >= grade.linhas)
+                    continue;
+
+                // No meio do anel só as duas colunas da borda são novas
+                int passo = (y == cy - anel || y == cy + anel) ? 1 : 2 * anel;
+                if (passo == 0)
+                    passo = 1;
+
+                for (int x = cx - anel; x <= cx + anel; x += passo)
+                {
+                    if (x < 0 || x >= grade.colunas)
+                        continue;
+
+                    int c = y * grade.colunas + x;
+                    for (int p = grade.inicio[c]; p < grade.inicio[c + 1]; p++)
+                    {
+                        int j = grade.pontos[p];
+                        if (j == i)
+                            continue;
+
+                        float dx = xs[i] - xs[j];
+                        float dy = ys[i] - ys[j];
+                        qtd = insereCandidato(melhores, dists, qtd, k, j, dx * dx + dy * dy);
+                    }
+                }
+            }
+
+            // Qualquer ponto fora deste anel está a pelo menos anel * tamCelula de distância
+            float alcance = anel * grade.tamCelula;
+            if (qtd == k && dists[k - 1] <= alcance * alcance)
+                break;
+        }
+    }
+
+    free(dists);
+    free(grade.inicio);
+    free(grade.pontos);
+    free(xs);
+    free(ys);
+
+    return vizinhos;
+}
+
+tVizinhos *initVizinhosDeVetor(int *lista, int tam, int k)
+{
+    tVizinhos *vizinhos = (tVizinhos *)malloc(sizeof(tVizinhos));
+
+    vizinhos->k = k;
+    vizinhos->tam = tam;
+    vizinhos->lista = (int *)malloc((size_t)tam * (k > 0 ? k : 1) * sizeof(int));
+    memcpy(vizinhos->lista, lista, (size_t)tam * k * sizeof(int));
+
+    return vizinhos;
+}
+
+void freeVizinhos(tVizinhos *vizinhos)
+{
+    free(vizinhos->lista);
+    free(vizinhos);
+}
+
+int getQtdVizinhos(tVizinhos *vizinhos)
+{
+    return vizinhos->k;
+}
+
+int *getVizinhos(tVizinhos *vizinhos, int indice)
+{
+    return &(vizinhos->lista[(size_t)indice * vizinhos->k]);
+}
@@ -0,0 +1,55 @@
+#ifndef VIZINHOS_H
+#define VIZINHOS_H
+
+#include "grafo.h"
+
+typedef struct stVizinhos tVizinhos;
+
+/**
+ * @brief Cria as listas de candidatos: os k vizinhos mais próximos de cada vértice
+ * @details Usa uma grade uniforme sobre as coordenadas, então não precisa do vetor de arestas.
+ * Cada lista fica ordenada pela distância, do mais próximo para o mais distante.
+ *
+ * @param grafo Grafo com o vetor de vértices preenchido
+ * @param k Quantidade de vizinhos por vértice (é limitado a Qtd_vértices - 1)
+ * @return tVizinhos*
+ */
+tVizinhos *initVizinhos(tGrafo *grafo, int k);
+
+/**
+ * @brief Cria as listas de candidatos a partir de um vetor já pronto
+ * @details Serve para listas calculadas por outros critérios (ex.: alpha-nearness).
+ *
+ * @param lista Vetor com tam * k índices, k por vértice (é copiado)
+ * @param tam Quantidade de vértices
+ * @param k Quantidade de vizinhos por vértice
+ * @return tVizinhos*
+ */
+tVizinhos *initVizinhosDeVetor(int *lista, int tam, int k);
+
+/**
+ * @brief Destrói as listas de candidatos
+ *
+ * @param vizinhos Listas a serem liberadas
+ */
+void freeVizinhos(tVizinhos *vizinhos);
+
+/**
+ * @brief Pega a quantidade de vizinhos guardados por vértice
+ *
+ * @param vizinhos Listas de candidatos
+ * @return int
+ */
+int getQtdVizinhos(tVizinhos *vizinhos);
+
+/**
+ * @brief Pega a lista de vizinhos de um vértice
+ * @details O vetor retornado tem getQtdVizinhos() posições e pertence à estrutura.
+ *
+ * @param vizinhos Listas de candidatos
+ * @param indice Índice do vértice
+ * @return int*
+ */
+int *getVizinhos(tVizinhos *vizinhos, int indice);
+
+#endif